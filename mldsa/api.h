@@ -8,105 +8,345 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/* Size of a seed-only secret key */
+#define MLD_SEEDBYTES 32
+
 #define MLD_44_PUBLICKEYBYTES 1312
 #define MLD_44_SECRETKEYBYTES 2560
 #define MLD_44_BYTES 2420
+#define MLD_44_EXPANDED_PUBLICKEYBYTES 20608
+#define MLD_44_EXPANDED_SECRETKEYBYTES 28864
+#define MLD_44_COMPACT_SECRETKEYBYTES 4288
 
 #define MLD_44_ref_PUBLICKEYBYTES MLD_44_PUBLICKEYBYTES
 #define MLD_44_ref_SECRETKEYBYTES MLD_44_SECRETKEYBYTES
 #define MLD_44_ref_BYTES MLD_44_BYTES
+#define MLD_44_ref_EXPANDED_PUBLICKEYBYTES MLD_44_EXPANDED_PUBLICKEYBYTES
+#define MLD_44_ref_EXPANDED_SECRETKEYBYTES MLD_44_EXPANDED_SECRETKEYBYTES
+#define MLD_44_ref_COMPACT_SECRETKEYBYTES MLD_44_COMPACT_SECRETKEYBYTES
 
 int MLD_44_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_44_ref_keypair_batch(uint8_t *pk, uint8_t *sk, size_t n);
+
+/* Only available if built with MLD_CONFIG_KEYPOOL */
+int MLD_44_ref_keypool_init(size_t capacity);
+int MLD_44_ref_keypool_pop(uint8_t *pk, uint8_t *sk);
+void MLD_44_ref_keypool_free(void);
+
+int MLD_44_ref_keypair_seed(uint8_t *pk, uint8_t seed[MLD_SEEDBYTES]);
+
+int MLD_44_ref_pk_from_seed(uint8_t *pk, const uint8_t seed[MLD_SEEDBYTES]);
+
 int MLD_44_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_44_ref_signature_seed(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                              size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                              const uint8_t seed[MLD_SEEDBYTES]);
+
+/* Expanded keys, see mldsa/expanded.h */
+int MLD_44_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+int MLD_44_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+int MLD_44_ref_expanded_pk_check(const uint8_t *epk, size_t len);
+int MLD_44_ref_expanded_sk_check(const uint8_t *esk, size_t len);
+int MLD_44_ref_compact_sk(uint8_t *csk, const uint8_t *sk);
+int MLD_44_ref_compact_sk_check(const uint8_t *csk, size_t len);
+
+int MLD_44_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *esk);
+
+int MLD_44_ref_signature_compact(uint8_t *sig, size_t *siglen,
+                                 const uint8_t *m, size_t mlen,
+                                 const uint8_t *ctx, size_t ctxlen,
+                                 const uint8_t *csk);
+
 int MLD_44_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
+int MLD_44_ref_inplace(uint8_t *sm, size_t *smlen, size_t mlen,
+                       const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+
 int MLD_44_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_44_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t *epk);
+
+/* Only available if built with MLD_CONFIG_VERIFY_CACHE */
+void MLD_44_ref_verify_cache_stats(uint64_t *hits, uint64_t *misses);
+void MLD_44_ref_verify_cache_clear(void);
+
 int MLD_44_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+int MLD_44_ref_open_inplace(const uint8_t **m, size_t *mlen,
+                            const uint8_t *sm, size_t smlen,
+                            const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk);
+
 #define MLD_65_PUBLICKEYBYTES 1952
 #define MLD_65_SECRETKEYBYTES 4032
 #define MLD_65_BYTES 3309
+#define MLD_65_EXPANDED_PUBLICKEYBYTES 36992
+#define MLD_65_EXPANDED_SECRETKEYBYTES 48320
+#define MLD_65_COMPACT_SECRETKEYBYTES 6080
 
 #define MLD_65_ref_PUBLICKEYBYTES MLD_65_PUBLICKEYBYTES
 #define MLD_65_ref_SECRETKEYBYTES MLD_65_SECRETKEYBYTES
 #define MLD_65_ref_BYTES MLD_65_BYTES
+#define MLD_65_ref_EXPANDED_PUBLICKEYBYTES MLD_65_EXPANDED_PUBLICKEYBYTES
+#define MLD_65_ref_EXPANDED_SECRETKEYBYTES MLD_65_EXPANDED_SECRETKEYBYTES
+#define MLD_65_ref_COMPACT_SECRETKEYBYTES MLD_65_COMPACT_SECRETKEYBYTES
 
 int MLD_65_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_65_ref_keypair_batch(uint8_t *pk, uint8_t *sk, size_t n);
+
+/* Only available if built with MLD_CONFIG_KEYPOOL */
+int MLD_65_ref_keypool_init(size_t capacity);
+int MLD_65_ref_keypool_pop(uint8_t *pk, uint8_t *sk);
+void MLD_65_ref_keypool_free(void);
+
+int MLD_65_ref_keypair_seed(uint8_t *pk, uint8_t seed[MLD_SEEDBYTES]);
+
+int MLD_65_ref_pk_from_seed(uint8_t *pk, const uint8_t seed[MLD_SEEDBYTES]);
+
 int MLD_65_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_65_ref_signature_seed(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                              size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                              const uint8_t seed[MLD_SEEDBYTES]);
+
+/* Expanded keys, see mldsa/expanded.h */
+int MLD_65_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+int MLD_65_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+int MLD_65_ref_expanded_pk_check(const uint8_t *epk, size_t len);
+int MLD_65_ref_expanded_sk_check(const uint8_t *esk, size_t len);
+int MLD_65_ref_compact_sk(uint8_t *csk, const uint8_t *sk);
+int MLD_65_ref_compact_sk_check(const uint8_t *csk, size_t len);
+
+int MLD_65_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *esk);
+
+int MLD_65_ref_signature_compact(uint8_t *sig, size_t *siglen,
+                                 const uint8_t *m, size_t mlen,
+                                 const uint8_t *ctx, size_t ctxlen,
+                                 const uint8_t *csk);
+
 int MLD_65_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
+int MLD_65_ref_inplace(uint8_t *sm, size_t *smlen, size_t mlen,
+                       const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+
 int MLD_65_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_65_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t *epk);
+
+/* Only available if built with MLD_CONFIG_VERIFY_CACHE */
+void MLD_65_ref_verify_cache_stats(uint64_t *hits, uint64_t *misses);
+void MLD_65_ref_verify_cache_clear(void);
+
 int MLD_65_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+int MLD_65_ref_open_inplace(const uint8_t **m, size_t *mlen,
+                            const uint8_t *sm, size_t smlen,
+                            const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk);
+
 #define MLD_87_PUBLICKEYBYTES 2592
 #define MLD_87_SECRETKEYBYTES 4896
 #define MLD_87_BYTES 4627
+#define MLD_87_EXPANDED_PUBLICKEYBYTES 65664
+#define MLD_87_EXPANDED_SECRETKEYBYTES 81088
+#define MLD_87_COMPACT_SECRETKEYBYTES 8128
 
 #define MLD_87_ref_PUBLICKEYBYTES MLD_87_PUBLICKEYBYTES
 #define MLD_87_ref_SECRETKEYBYTES MLD_87_SECRETKEYBYTES
 #define MLD_87_ref_BYTES MLD_87_BYTES
+#define MLD_87_ref_EXPANDED_PUBLICKEYBYTES MLD_87_EXPANDED_PUBLICKEYBYTES
+#define MLD_87_ref_EXPANDED_SECRETKEYBYTES MLD_87_EXPANDED_SECRETKEYBYTES
+#define MLD_87_ref_COMPACT_SECRETKEYBYTES MLD_87_COMPACT_SECRETKEYBYTES
 
 int MLD_87_ref_keypair(uint8_t *pk, uint8_t *sk);
 
+int MLD_87_ref_keypair_batch(uint8_t *pk, uint8_t *sk, size_t n);
+
+/* Only available if built with MLD_CONFIG_KEYPOOL */
+int MLD_87_ref_keypool_init(size_t capacity);
+int MLD_87_ref_keypool_pop(uint8_t *pk, uint8_t *sk);
+void MLD_87_ref_keypool_free(void);
+
+int MLD_87_ref_keypair_seed(uint8_t *pk, uint8_t seed[MLD_SEEDBYTES]);
+
+int MLD_87_ref_pk_from_seed(uint8_t *pk, const uint8_t seed[MLD_SEEDBYTES]);
+
 int MLD_87_ref_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                          size_t mlen, const uint8_t *ctx, size_t ctxlen,
                          const uint8_t *sk);
 
+int MLD_87_ref_signature_seed(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                              size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                              const uint8_t seed[MLD_SEEDBYTES]);
+
+/* Expanded keys, see mldsa/expanded.h */
+int MLD_87_ref_expand_pk(uint8_t *epk, const uint8_t *pk);
+int MLD_87_ref_expand_sk(uint8_t *esk, const uint8_t *sk);
+int MLD_87_ref_expanded_pk_check(const uint8_t *epk, size_t len);
+int MLD_87_ref_expanded_sk_check(const uint8_t *esk, size_t len);
+int MLD_87_ref_compact_sk(uint8_t *csk, const uint8_t *sk);
+int MLD_87_ref_compact_sk_check(const uint8_t *csk, size_t len);
+
+int MLD_87_ref_signature_expanded(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *esk);
+
+int MLD_87_ref_signature_compact(uint8_t *sig, size_t *siglen,
+                                 const uint8_t *m, size_t mlen,
+                                 const uint8_t *ctx, size_t ctxlen,
+                                 const uint8_t *csk);
+
 int MLD_87_ref(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
+int MLD_87_ref_inplace(uint8_t *sm, size_t *smlen, size_t mlen,
+                       const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+
 int MLD_87_ref_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                       size_t mlen, const uint8_t *ctx, size_t ctxlen,
                       const uint8_t *pk);
 
+int MLD_87_ref_verify_expanded(const uint8_t *sig, size_t siglen,
+                               const uint8_t *m, size_t mlen,
+                               const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t *epk);
+
+/* Only available if built with MLD_CONFIG_VERIFY_CACHE */
+void MLD_87_ref_verify_cache_stats(uint64_t *hits, uint64_t *misses);
+void MLD_87_ref_verify_cache_clear(void);
+
 int MLD_87_ref_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+int MLD_87_ref_open_inplace(const uint8_t **m, size_t *mlen,
+                            const uint8_t *sm, size_t smlen,
+                            const uint8_t *ctx, size_t ctxlen,
+                            const uint8_t *pk);
+
 #if MLDSA_MODE == 2
 #define CRYPTO_PUBLICKEYBYTES MLD_44_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_44_SECRETKEYBYTES
 #define CRYPTO_BYTES MLD_44_BYTES
+#define CRYPTO_EXPANDED_PUBLICKEYBYTES MLD_44_EXPANDED_PUBLICKEYBYTES
+#define CRYPTO_EXPANDED_SECRETKEYBYTES MLD_44_EXPANDED_SECRETKEYBYTES
+#define CRYPTO_COMPACT_SECRETKEYBYTES MLD_44_COMPACT_SECRETKEYBYTES
 #define crypto_sign_keypair MLD_44_ref_keypair
+#define crypto_sign_keypair_batch MLD_44_ref_keypair_batch
+#define crypto_sign_keypool_init MLD_44_ref_keypool_init
+#define crypto_sign_keypool_pop MLD_44_ref_keypool_pop
+#define crypto_sign_keypool_free MLD_44_ref_keypool_free
+#define crypto_sign_keypair_seed MLD_44_ref_keypair_seed
+#define crypto_sign_verify_cache_stats MLD_44_ref_verify_cache_stats
+#define crypto_sign_verify_cache_clear MLD_44_ref_verify_cache_clear
+#define crypto_sign_pk_from_seed MLD_44_ref_pk_from_seed
 #define crypto_sign_signature MLD_44_ref_signature
+#define crypto_sign_signature_seed MLD_44_ref_signature_seed
+#define crypto_sign_expand_pk MLD_44_ref_expand_pk
+#define crypto_sign_expand_sk MLD_44_ref_expand_sk
+#define crypto_sign_expanded_pk_check MLD_44_ref_expanded_pk_check
+#define crypto_sign_expanded_sk_check MLD_44_ref_expanded_sk_check
+#define crypto_sign_signature_expanded MLD_44_ref_signature_expanded
+#define crypto_sign_compact_sk MLD_44_ref_compact_sk
+#define crypto_sign_compact_sk_check MLD_44_ref_compact_sk_check
+#define crypto_sign_signature_compact MLD_44_ref_signature_compact
 #define crypto_sign MLD_44_ref
+#define crypto_sign_inplace MLD_44_ref_inplace
 #define crypto_sign_verify MLD_44_ref_verify
+#define crypto_sign_verify_expanded MLD_44_ref_verify_expanded
 #define crypto_sign_open MLD_44_ref_open
+#define crypto_sign_open_inplace MLD_44_ref_open_inplace
 #elif MLDSA_MODE == 3
 #define CRYPTO_PUBLICKEYBYTES MLD_65_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_65_SECRETKEYBYTES
 #define CRYPTO_BYTES MLD_65_BYTES
+#define CRYPTO_EXPANDED_PUBLICKEYBYTES MLD_65_EXPANDED_PUBLICKEYBYTES
+#define CRYPTO_EXPANDED_SECRETKEYBYTES MLD_65_EXPANDED_SECRETKEYBYTES
+#define CRYPTO_COMPACT_SECRETKEYBYTES MLD_65_COMPACT_SECRETKEYBYTES
 #define crypto_sign_keypair MLD_65_ref_keypair
+#define crypto_sign_keypair_batch MLD_65_ref_keypair_batch
+#define crypto_sign_keypool_init MLD_65_ref_keypool_init
+#define crypto_sign_keypool_pop MLD_65_ref_keypool_pop
+#define crypto_sign_keypool_free MLD_65_ref_keypool_free
+#define crypto_sign_keypair_seed MLD_65_ref_keypair_seed
+#define crypto_sign_verify_cache_stats MLD_65_ref_verify_cache_stats
+#define crypto_sign_verify_cache_clear MLD_65_ref_verify_cache_clear
+#define crypto_sign_pk_from_seed MLD_65_ref_pk_from_seed
 #define crypto_sign_signature MLD_65_ref_signature
+#define crypto_sign_signature_seed MLD_65_ref_signature_seed
+#define crypto_sign_expand_pk MLD_65_ref_expand_pk
+#define crypto_sign_expand_sk MLD_65_ref_expand_sk
+#define crypto_sign_expanded_pk_check MLD_65_ref_expanded_pk_check
+#define crypto_sign_expanded_sk_check MLD_65_ref_expanded_sk_check
+#define crypto_sign_signature_expanded MLD_65_ref_signature_expanded
+#define crypto_sign_compact_sk MLD_65_ref_compact_sk
+#define crypto_sign_compact_sk_check MLD_65_ref_compact_sk_check
+#define crypto_sign_signature_compact MLD_65_ref_signature_compact
 #define crypto_sign MLD_65_ref
+#define crypto_sign_inplace MLD_65_ref_inplace
 #define crypto_sign_verify MLD_65_ref_verify
+#define crypto_sign_verify_expanded MLD_65_ref_verify_expanded
 #define crypto_sign_open MLD_65_ref_open
+#define crypto_sign_open_inplace MLD_65_ref_open_inplace
 #elif MLDSA_MODE == 5
 #define CRYPTO_PUBLICKEYBYTES MLD_87_PUBLICKEYBYTES
 #define CRYPTO_SECRETKEYBYTES MLD_87_SECRETKEYBYTES
 #define CRYPTO_BYTES MLD_87_BYTES
+#define CRYPTO_EXPANDED_PUBLICKEYBYTES MLD_87_EXPANDED_PUBLICKEYBYTES
+#define CRYPTO_EXPANDED_SECRETKEYBYTES MLD_87_EXPANDED_SECRETKEYBYTES
+#define CRYPTO_COMPACT_SECRETKEYBYTES MLD_87_COMPACT_SECRETKEYBYTES
 #define crypto_sign_keypair MLD_87_ref_keypair
+#define crypto_sign_keypair_batch MLD_87_ref_keypair_batch
+#define crypto_sign_keypool_init MLD_87_ref_keypool_init
+#define crypto_sign_keypool_pop MLD_87_ref_keypool_pop
+#define crypto_sign_keypool_free MLD_87_ref_keypool_free
+#define crypto_sign_keypair_seed MLD_87_ref_keypair_seed
+#define crypto_sign_verify_cache_stats MLD_87_ref_verify_cache_stats
+#define crypto_sign_verify_cache_clear MLD_87_ref_verify_cache_clear
+#define crypto_sign_pk_from_seed MLD_87_ref_pk_from_seed
 #define crypto_sign_signature MLD_87_ref_signature
+#define crypto_sign_signature_seed MLD_87_ref_signature_seed
+#define crypto_sign_expand_pk MLD_87_ref_expand_pk
+#define crypto_sign_expand_sk MLD_87_ref_expand_sk
+#define crypto_sign_expanded_pk_check MLD_87_ref_expanded_pk_check
+#define crypto_sign_expanded_sk_check MLD_87_ref_expanded_sk_check
+#define crypto_sign_signature_expanded MLD_87_ref_signature_expanded
+#define crypto_sign_compact_sk MLD_87_ref_compact_sk
+#define crypto_sign_compact_sk_check MLD_87_ref_compact_sk_check
+#define crypto_sign_signature_compact MLD_87_ref_signature_compact
 #define crypto_sign MLD_87_ref
+#define crypto_sign_inplace MLD_87_ref_inplace
 #define crypto_sign_verify MLD_87_ref_verify
+#define crypto_sign_verify_expanded MLD_87_ref_verify_expanded
 #define crypto_sign_open MLD_87_ref_open
+#define crypto_sign_open_inplace MLD_87_ref_open_inplace
 #endif /* MLDSA_MODE == 5 */
 
 
@@ -15,10 +15,25 @@
 #error Bad configuration: MLD_CONFIG_USE_NATIVE_BACKEND_ARITH is set, but MLD_CONFIG_ARITH_BACKEND_FILE is not.
 #endif
 
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202) && \
+    !defined(MLD_CONFIG_FIPS202_BACKEND_FILE)
+#error Bad configuration: MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 is set, but MLD_CONFIG_FIPS202_BACKEND_FILE is not.
+#endif
+
+/* Return values of native functions which may decline to handle a call,
+ * e.g. because the host lacks a required instruction set extension.
+ * See native/api.h. */
+#define MLD_NATIVE_FUNC_SUCCESS (0)
+#define MLD_NATIVE_FUNC_FALLBACK (-1)
+
 #if defined(MLD_CONFIG_USE_NATIVE_BACKEND_ARITH)
 #include MLD_CONFIG_ARITH_BACKEND_FILE
 #endif
 
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202)
+#include MLD_CONFIG_FIPS202_BACKEND_FILE
+#endif
+
 #define MLD_CONCAT_(x1, x2) x1##x2
 #define MLD_CONCAT(x1, x2) MLD_CONCAT_(x1, x2)
 
@@ -26,9 +41,9 @@
  * in front of assembly symbols. We thus introducee a separate
  * namespace wrapper for ASM symbols. */
 #if !defined(__APPLE__)
-#define MLD_ASM_NAMESPACE(sym) MLD_NAMESPACE(sym)
+#define MLD_ASM_NAMESPACE(sym) MLD_NAMESPACE_SHARED(sym)
 #else
-#define MLD_ASM_NAMESPACE(sym) MLD_CONCAT(_, MLD_NAMESPACE(sym))
+#define MLD_ASM_NAMESPACE(sym) MLD_CONCAT(_, MLD_NAMESPACE_SHARED(sym))
 #endif
 
 /*
@@ -25,6 +25,14 @@
 #define MLD_NAMESPACE(s) MLD_87_ref_##s
 #endif
 
+/* Namespace for code which does not depend on the parameter set: FIPS202,
+ * the NTT, modular reduction, the parameter-independent polynomial
+ * arithmetic and packing (poly.h), as well as the capability check,
+ * tracing and statistics. In builds containing more than one parameter
+ * set, this code must only be compiled once; see
+ * MLD_CONFIG_MULTILEVEL_NO_SHARED. */
+#define MLD_NAMESPACE_SHARED(s) MLD_ref_##s
+
 /******************************************************************************
  * Name:        MLD_CONFIG_ARITH_BACKEND_FILE
  *
@@ -45,4 +53,197 @@
 #define MLD_CONFIG_ARITH_BACKEND_FILE "native/meta.h"
 #endif
 
+/******************************************************************************
+ * Name:        MLD_CONFIG_FIPS202_BACKEND_FILE
+ *
+ * Description: The FIPS-202 backend to use.
+ *
+ *              If MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 is unset, this option
+ *              is ignored.
+ *
+ *              If MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202 is set, this option
+ *              must either be undefined or the filename of a FIPS-202
+ *              backend. If unset, the default backend will be used.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+#if defined(MLD_CONFIG_USE_NATIVE_BACKEND_FIPS202) && \
+    !defined(MLD_CONFIG_FIPS202_BACKEND_FILE)
+#define MLD_CONFIG_FIPS202_BACKEND_FILE "fips202/native/meta.h"
+#endif
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_CUSTOM_CAPABILITY_FUNC
+ *
+ * Description: Native backends using optional instruction set extensions
+ *              check for their availability at runtime through
+ *              mld_sys_check_capability(), and fall back to the C code if
+ *              they are unavailable.
+ *
+ *              By default, sys.c implements this function by probing the
+ *              host once, via CPUID on x86_64 and HWCAP on AArch64 Linux,
+ *              and relies on compile-time feature macros elsewhere.
+ *
+ *              If this option is set, sys.c is empty and the application
+ *              must provide
+ *
+ *                int mld_sys_check_capability(mld_sys_cap cap);
+ *
+ *              (namespaced as per MLD_NAMESPACE_SHARED, see sys.h) itself,
+ *              e.g.
+ *              to use a platform-specific detection mechanism or to force
+ *              the C fallback in tests.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_CUSTOM_CAPABILITY_FUNC */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_TRACE
+ *
+ * Description: If set, keypair generation, signing and verification report
+ *              the cycles spent in each of their stages to a callback
+ *              registered via mld_trace_register(). See trace.h for the
+ *              list of stages.
+ *
+ *              If unset, the trace probes compile to nothing and have no
+ *              cost.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_TRACE */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_STATS
+ *
+ * Description: If set, the library maintains per-thread operation counters:
+ *              Keccak permutations, NTTs and inverse NTTs, blocks squeezed
+ *              by rejection sampling beyond the initial buffer, and a
+ *              histogram of the number of rejections per signature.
+ *              They are read and reset via mld_stats_get() and
+ *              mld_stats_reset(); see stats.h.
+ *
+ *              The counters require thread-local storage support
+ *              (__thread, or __declspec(thread) on MSVC).
+ *
+ *              If unset, the counters compile to nothing.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_STATS */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_KEYPOOL
+ *
+ * Description: If set, the library provides a pool of pre-generated key
+ *              pairs, refilled by a background thread, via
+ *              crypto_sign_keypool_init(), crypto_sign_keypool_pop() and
+ *              crypto_sign_keypool_free(); see keypool.h.
+ *
+ *              The pool requires POSIX threads and malloc(), and the
+ *              randombytes() implementation must be safe to call from
+ *              the refill thread.
+ *
+ *              If unset, keypool.c is empty.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_KEYPOOL */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_VERIFY_CACHE
+ *
+ * Description: If set, verification keeps the expanded form of recently
+ *              used public keys -- the matrix A and t1, both in NTT
+ *              domain -- in a cache keyed by tr = H(pk), so that repeated
+ *              verifications under the same public key skip ExpandA.
+ *
+ *              The cache holds MLD_CONFIG_VERIFY_CACHE_ENTRIES public
+ *              keys (default 16) per parameter set in static storage,
+ *              in shards with least-recently-used eviction. Each entry
+ *              takes (K*L + K) * 1KB, e.g. 64KB for ML-DSA-87.
+ *              Hits and misses are reported by
+ *              crypto_sign_verify_cache_stats(); see verify_cache.h.
+ *
+ *              The shards are protected by POSIX mutexes.
+ *
+ *              If unset, verify_cache.c is empty.
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_VERIFY_CACHE */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_VERIFY_CACHE_ENTRIES
+ *
+ * Description: Number of public keys held by the verification cache if
+ *              MLD_CONFIG_VERIFY_CACHE is set. Rounded down to a multiple
+ *              of the number of shards (4).
+ *
+ *              This can be set using CFLAGS.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_VERIFY_CACHE_ENTRIES 16 */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_INTERNAL_API_QUALIFIER
+ *
+ * Description: If set, this option provides an additional function
+ *              qualifier to be added to declarations of internal API.
+ *
+ *              The primary use case for this option are single-CU builds
+ *              via mldsa_native.c, where the qualifier can be set to
+ *              `static` so that only the public API is exported and the
+ *              compiler is free to inline, specialize or drop any
+ *              internal function.
+ *
+ *              Internal functions which are unused in a particular
+ *              configuration then trigger -Wunused-function, which needs
+ *              to be disabled for such builds.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_INTERNAL_API_QUALIFIER */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_MULTILEVEL_NO_SHARED
+ *
+ * Description: This is for single-CU builds containing more than one
+ *              parameter set, where mldsa_native.c is included once per
+ *              parameter set.
+ *
+ *              If set, mldsa_native.c omits the code which is shared between
+ *              all parameter sets (FIPS202, capability check, tracing,
+ *              statistics and native backend data). It must then be set
+ *              for all but one of the inclusions of mldsa_native.c.
+ *
+ *              See test/mldsa_native_all.c for an example.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_MULTILEVEL_NO_SHARED */
+
+/******************************************************************************
+ * Name:        MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS
+ *
+ * Description: This is for single-CU builds containing more than one
+ *              parameter set, where mldsa_native.c is included once per
+ *              parameter set.
+ *
+ *              At its end, mldsa_native.c undefines all macros it defined,
+ *              so that it can be included again for a different parameter
+ *              set. If this option is set, the macros of headers which do
+ *              not depend on the parameter set are retained, so that those
+ *              headers are not processed again. It must be set for all but
+ *              the last inclusion of mldsa_native.c.
+ *
+ *              See test/mldsa_native_all.c for an example.
+ *
+ *****************************************************************************/
+/* #define MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS */
+
 #endif /* !MLD_CONFIG_H */
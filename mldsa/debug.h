@@ -22,7 +22,8 @@
  *              - line: line number
  *              - val: Value asserted to be non-zero
  **************************************************/
-#define mld_debug_check_assert MLD_NAMESPACE(mldsa_debug_assert)
+#define mld_debug_check_assert MLD_NAMESPACE_SHARED(mldsa_debug_assert)
+MLD_INTERNAL_API
 void mld_debug_check_assert(const char *file, int line, const int val);
 
 /*************************************************
@@ -41,7 +42,8 @@ void mld_debug_check_assert(const char *file, int line, const int val);
  *              - lower_bound_exclusive: Exclusive lower bound
  *              - upper_bound_exclusive: Exclusive upper bound
  **************************************************/
-#define mld_debug_check_bounds MLD_NAMESPACE(mldsa_debug_check_bounds)
+#define mld_debug_check_bounds MLD_NAMESPACE_SHARED(mldsa_debug_check_bounds)
+MLD_INTERNAL_API
 void mld_debug_check_bounds(const char *file, int line, const int32_t *ptr,
                             unsigned len, int lower_bound_exclusive,
                             int upper_bound_exclusive);
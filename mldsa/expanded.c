@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "expanded.h"
+#include "fips202/fips202.h"
+#include "packing.h"
+#include "polyvec.h"
+
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mld_expanded_size_check MLD_NAMESPACE(expanded_size_check)
+#define mld_expanded_aligned MLD_NAMESPACE(expanded_aligned)
+#define mld_expanded_header_init MLD_NAMESPACE(expanded_header_init)
+#define mld_expanded_header_ok MLD_NAMESPACE(expanded_header_ok)
+#define mld_expanded_digest_ok MLD_NAMESPACE(expanded_digest_ok)
+/* End of static namespacing */
+
+#if MLDSA_MODE == 2
+#define MLD_EXPANDED_PARAMS 44
+#elif MLDSA_MODE == 3
+#define MLD_EXPANDED_PARAMS 65
+#elif MLDSA_MODE == 5
+#define MLD_EXPANDED_PARAMS 87
+#endif
+
+/* The serialized sizes are part of the format: fail the build if the
+ * structures do not match them, e.g. because of padding. */
+typedef char mld_expanded_size_check
+    [(sizeof(mld_expanded_header) == 64 &&
+      sizeof(mld_expanded_pk) == CRYPTO_EXPANDED_PUBLICKEYBYTES &&
+      sizeof(mld_expanded_sk) == CRYPTO_EXPANDED_SECRETKEYBYTES &&
+      sizeof(mld_expanded_csk) == CRYPTO_COMPACT_SECRETKEYBYTES)
+         ? 1
+         : -1];
+
+static int mld_expanded_aligned(const uint8_t *p)
+{
+  return ((uintptr_t)p % sizeof(int32_t)) == 0;
+}
+
+/* Writes the header for the body following it; the body must be
+ * complete. */
+static void mld_expanded_header_init(mld_expanded_header *hdr,
+                                     const char magic[8], size_t size)
+{
+  memcpy(hdr->magic, magic, 8);
+  hdr->version = MLD_EXPANDED_VERSION;
+  hdr->params = MLD_EXPANDED_PARAMS;
+  hdr->size = (uint32_t)size;
+  hdr->bom = MLD_EXPANDED_BOM;
+  memset(hdr->reserved, 0, sizeof(hdr->reserved));
+  sha3_256(hdr->digest, (const uint8_t *)hdr + sizeof(mld_expanded_header),
+           size - sizeof(mld_expanded_header));
+}
+
+/* Checks the digest in the header against the body; len is the total
+ * size, which the caller has checked against the header. */
+static int mld_expanded_digest_ok(const uint8_t *p, size_t len)
+{
+  uint8_t digest[SHA3_256_HASHBYTES];
+
+  sha3_256(digest, p + sizeof(mld_expanded_header),
+           len - sizeof(mld_expanded_header));
+  return memcmp(digest, ((const mld_expanded_header *)p)->digest,
+                SHA3_256_HASHBYTES) == 0;
+}
+
+static int mld_expanded_header_ok(const uint8_t *p, const char magic[8],
+                                  size_t size)
+{
+  const mld_expanded_header *hdr = (const mld_expanded_header *)p;
+
+  return mld_expanded_aligned(p) && memcmp(hdr->magic, magic, 8) == 0 &&
+         hdr->version == MLD_EXPANDED_VERSION &&
+         hdr->params == MLD_EXPANDED_PARAMS && hdr->size == size &&
+         hdr->bom == MLD_EXPANDED_BOM;
+}
+
+int mld_expanded_pk_header_ok(const uint8_t *epk)
+{
+  return mld_expanded_header_ok(epk, "MLDSAEPK",
+                                CRYPTO_EXPANDED_PUBLICKEYBYTES);
+}
+
+int mld_expanded_sk_header_ok(const uint8_t *esk)
+{
+  return mld_expanded_header_ok(esk, "MLDSAESK",
+                                CRYPTO_EXPANDED_SECRETKEYBYTES);
+}
+
+int mld_compact_sk_header_ok(const uint8_t *csk)
+{
+  return mld_expanded_header_ok(csk, "MLDSACSK",
+                                CRYPTO_COMPACT_SECRETKEYBYTES);
+}
+
+int crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk)
+{
+  mld_expanded_pk *e = (mld_expanded_pk *)epk;
+  uint8_t rho[MLDSA_SEEDBYTES];
+
+  if (!mld_expanded_aligned(epk))
+  {
+    return -1;
+  }
+
+  shake256(e->tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  unpack_pk(rho, &e->t1, pk);
+  polyveck_shiftl(&e->t1);
+  polyveck_ntt(&e->t1);
+  polyvec_matrix_expand(e->mat, rho);
+
+  mld_expanded_header_init(&e->hdr, "MLDSAEPK", sizeof(mld_expanded_pk));
+  return 0;
+}
+
+int crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk)
+{
+  mld_expanded_sk *e = (mld_expanded_sk *)esk;
+  uint8_t rho[MLDSA_SEEDBYTES];
+
+  if (!mld_expanded_aligned(esk))
+  {
+    return -1;
+  }
+
+  unpack_sk(rho, e->tr, e->key, &e->t0, &e->s1, &e->s2, sk);
+  memset(e->reserved, 0, sizeof(e->reserved));
+  polyvecl_ntt(&e->s1);
+  polyveck_ntt(&e->s2);
+  polyveck_ntt(&e->t0);
+  polyvec_matrix_expand(e->mat, rho);
+
+  mld_expanded_header_init(&e->hdr, "MLDSAESK", sizeof(mld_expanded_sk));
+  return 0;
+}
+
+int crypto_sign_compact_sk(uint8_t *csk, const uint8_t *sk)
+{
+  mld_expanded_csk *e = (mld_expanded_csk *)csk;
+  unsigned int i, j;
+  polyvecl s1;
+  polyveck s2, t0;
+
+  if (!mld_expanded_aligned(csk))
+  {
+    return -1;
+  }
+
+  unpack_sk(e->rho, e->tr, e->key, &t0, &s1, &s2, sk);
+  for (i = 0; i < MLDSA_N; i++)
+  {
+    for (j = 0; j < MLDSA_L; j++)
+    {
+      e->s1[j][i] = (int8_t)s1.vec[j].coeffs[i];
+    }
+    for (j = 0; j < MLDSA_K; j++)
+    {
+      e->s2[j][i] = (int8_t)s2.vec[j].coeffs[i];
+      e->t0[j][i] = (int16_t)t0.vec[j].coeffs[i];
+    }
+  }
+
+  mld_expanded_header_init(&e->hdr, "MLDSACSK", sizeof(mld_expanded_csk));
+  return 0;
+}
+
+int crypto_sign_expanded_pk_check(const uint8_t *epk, size_t len)
+{
+  if (len != CRYPTO_EXPANDED_PUBLICKEYBYTES || !mld_expanded_pk_header_ok(epk))
+  {
+    return -1;
+  }
+  return mld_expanded_digest_ok(epk, len) ? 0 : -1;
+}
+
+int crypto_sign_expanded_sk_check(const uint8_t *esk, size_t len)
+{
+  if (len != CRYPTO_EXPANDED_SECRETKEYBYTES || !mld_expanded_sk_header_ok(esk))
+  {
+    return -1;
+  }
+  return mld_expanded_digest_ok(esk, len) ? 0 : -1;
+}
+
+int crypto_sign_compact_sk_check(const uint8_t *csk, size_t len)
+{
+  if (len != CRYPTO_COMPACT_SECRETKEYBYTES || !mld_compact_sk_header_ok(csk))
+  {
+    return -1;
+  }
+  return mld_expanded_digest_ok(csk, len) ? 0 : -1;
+}
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef mld_expanded_size_check
+#undef mld_expanded_aligned
+#undef mld_expanded_header_init
+#undef mld_expanded_header_ok
+#undef mld_expanded_digest_ok
+#undef MLD_EXPANDED_PARAMS
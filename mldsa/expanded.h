@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_EXPANDED_H
+#define MLD_EXPANDED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+#include "polyvec.h"
+
+/* Serialized expanded keys
+ *
+ * An expanded key holds everything derived from a public or secret key
+ * which signing or verification would otherwise recompute: tr = H(pk),
+ * the matrix A and the vectors t1 (scaled by 2^d), t0, s1 and s2, all in
+ * NTT domain. Its byte representation is the in-memory representation
+ * used by the arithmetic, so that an expanded key written to a file can
+ * be mmap'ed read-only, shared between processes, and used in place.
+ *
+ * Layout, all integers in host byte order:
+ *
+ *   header (64 bytes):
+ *     magic      8 bytes   "MLDSAEPK" or "MLDSAESK"
+ *     version    uint32    MLD_EXPANDED_VERSION
+ *     params     uint32    44, 65 or 87
+ *     size       uint32    total size in bytes
+ *     bom        uint32    0x01020304, to reject foreign byte order
+ *     digest     32 bytes  SHA3-256 of all bytes following the header
+ *     reserved   8 bytes   zero
+ *   public:  tr, NTT(t1 * 2^d), A
+ *   secret:  tr, key, 32 reserved bytes, NTT(s1), NTT(s2), NTT(t0), A
+ *   compact secret: tr, key, rho, s1, s2, t0
+ *
+ * Polynomials are arrays of MLDSA_N int32 coefficients, except in compact
+ * secret keys: there, s1 and s2 are int8 and t0 is int16, all in normal
+ * domain, and signing multiplies them by the sparse challenge directly
+ * and expands A from rho. A compact secret key is several times smaller
+ * than an expanded one -- 8 KiB instead of 80 KiB for ML-DSA-87 -- for
+ * processes holding many signing keys. The version is increased whenever
+ * the layout or the representation of the coefficients changes.
+ *
+ * The digest protects against corruption and truncation, not against
+ * tampering: an expanded key must be protected like the key it was
+ * derived from. */
+
+#define MLD_EXPANDED_VERSION 1
+#define MLD_EXPANDED_BOM 0x01020304
+
+#define mld_expanded_header MLD_NAMESPACE(expanded_header)
+typedef struct
+{
+  uint8_t magic[8];
+  uint32_t version;
+  uint32_t params;
+  uint32_t size;
+  uint32_t bom;
+  uint8_t digest[32];
+  uint8_t reserved[8];
+} mld_expanded_header;
+
+#define mld_expanded_pk MLD_NAMESPACE(expanded_pk)
+typedef struct
+{
+  mld_expanded_header hdr;
+  uint8_t tr[MLDSA_TRBYTES];
+  polyveck t1;
+  polyvecl mat[MLDSA_K];
+} mld_expanded_pk;
+
+#define mld_expanded_sk MLD_NAMESPACE(expanded_sk)
+typedef struct
+{
+  mld_expanded_header hdr;
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t reserved[32];
+  polyvecl s1;
+  polyveck s2;
+  polyveck t0;
+  polyvecl mat[MLDSA_K];
+} mld_expanded_sk;
+
+#define mld_expanded_csk MLD_NAMESPACE(expanded_csk)
+typedef struct
+{
+  mld_expanded_header hdr;
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t rho[MLDSA_SEEDBYTES];
+  int8_t s1[MLDSA_L][MLDSA_N];
+  int8_t s2[MLDSA_K][MLDSA_N];
+  int16_t t0[MLDSA_K][MLDSA_N];
+} mld_expanded_csk;
+
+#define mld_expanded_pk_header_ok MLD_NAMESPACE(expanded_pk_header_ok)
+/*************************************************
+ * Name:        mld_expanded_pk_header_ok
+ *
+ * Description: Checks the header of an expanded public key, and that it
+ *              is suitably aligned to be used in place. The digest is
+ *              not checked; see crypto_sign_expanded_pk_check.
+ *
+ * Arguments:   - const uint8_t *epk: pointer to expanded public key
+ *
+ * Returns 1 if the header is valid, and 0 otherwise
+ **************************************************/
+MLD_INTERNAL_API
+int mld_expanded_pk_header_ok(const uint8_t *epk);
+
+#define mld_expanded_sk_header_ok MLD_NAMESPACE(expanded_sk_header_ok)
+/*************************************************
+ * Name:        mld_expanded_sk_header_ok
+ *
+ * Description: Checks the header of an expanded secret key, and that it
+ *              is suitably aligned to be used in place. The digest is
+ *              not checked; see crypto_sign_expanded_sk_check.
+ *
+ * Arguments:   - const uint8_t *esk: pointer to expanded secret key
+ *
+ * Returns 1 if the header is valid, and 0 otherwise
+ **************************************************/
+MLD_INTERNAL_API
+int mld_expanded_sk_header_ok(const uint8_t *esk);
+
+#define mld_compact_sk_header_ok MLD_NAMESPACE(compact_sk_header_ok)
+/*************************************************
+ * Name:        mld_compact_sk_header_ok
+ *
+ * Description: Checks the header of a compact secret key, and that it
+ *              is suitably aligned to be used in place. The digest is
+ *              not checked; see crypto_sign_compact_sk_check.
+ *
+ * Arguments:   - const uint8_t *csk: pointer to compact secret key
+ *
+ * Returns 1 if the header is valid, and 0 otherwise
+ **************************************************/
+MLD_INTERNAL_API
+int mld_compact_sk_header_ok(const uint8_t *csk);
+
+#define crypto_sign_expand_pk MLD_NAMESPACE(expand_pk)
+/*************************************************
+ * Name:        crypto_sign_expand_pk
+ *
+ * Description: Serializes the expanded form of a public key.
+ *
+ * Arguments:   - uint8_t *epk:      pointer to output expanded public key
+ *                                   (CRYPTO_EXPANDED_PUBLICKEYBYTES bytes,
+ *                                   4-byte aligned)
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *
+ * Returns 0 on success, and -1 if epk is not suitably aligned
+ **************************************************/
+int crypto_sign_expand_pk(uint8_t *epk, const uint8_t *pk);
+
+#define crypto_sign_expand_sk MLD_NAMESPACE(expand_sk)
+/*************************************************
+ * Name:        crypto_sign_expand_sk
+ *
+ * Description: Serializes the expanded form of a secret key.
+ *
+ * Arguments:   - uint8_t *esk:      pointer to output expanded secret key
+ *                                   (CRYPTO_EXPANDED_SECRETKEYBYTES bytes,
+ *                                   4-byte aligned)
+ *              - const uint8_t *sk: pointer to bit-packed secret key
+ *
+ * Returns 0 on success, and -1 if esk is not suitably aligned
+ **************************************************/
+int crypto_sign_expand_sk(uint8_t *esk, const uint8_t *sk);
+
+#define crypto_sign_compact_sk MLD_NAMESPACE(compact_sk)
+/*************************************************
+ * Name:        crypto_sign_compact_sk
+ *
+ * Description: Serializes the compact form of a secret key.
+ *
+ * Arguments:   - uint8_t *csk:      pointer to output compact secret key
+ *                                   (CRYPTO_COMPACT_SECRETKEYBYTES bytes,
+ *                                   4-byte aligned)
+ *              - const uint8_t *sk: pointer to bit-packed secret key
+ *
+ * Returns 0 on success, and -1 if csk is not suitably aligned
+ **************************************************/
+int crypto_sign_compact_sk(uint8_t *csk, const uint8_t *sk);
+
+#define crypto_sign_expanded_pk_check MLD_NAMESPACE(expanded_pk_check)
+/*************************************************
+ * Name:        crypto_sign_expanded_pk_check
+ *
+ * Description: Checks that a buffer, e.g. a mapped file, holds a complete
+ *              and uncorrupted expanded public key for this parameter set.
+ *              This should be called once after loading an expanded key,
+ *              before using it.
+ *
+ * Arguments:   - const uint8_t *epk: pointer to expanded public key
+ *              - size_t len:         length of the buffer
+ *
+ * Returns 0 if the expanded public key is valid, and -1 otherwise
+ **************************************************/
+int crypto_sign_expanded_pk_check(const uint8_t *epk, size_t len);
+
+#define crypto_sign_expanded_sk_check MLD_NAMESPACE(expanded_sk_check)
+/*************************************************
+ * Name:        crypto_sign_expanded_sk_check
+ *
+ * Description: Checks that a buffer, e.g. a mapped file, holds a complete
+ *              and uncorrupted expanded secret key for this parameter set.
+ *              This should be called once after loading an expanded key,
+ *              before using it.
+ *
+ * Arguments:   - const uint8_t *esk: pointer to expanded secret key
+ *              - size_t len:         length of the buffer
+ *
+ * Returns 0 if the expanded secret key is valid, and -1 otherwise
+ **************************************************/
+int crypto_sign_expanded_sk_check(const uint8_t *esk, size_t len);
+
+#define crypto_sign_compact_sk_check MLD_NAMESPACE(compact_sk_check)
+/*************************************************
+ * Name:        crypto_sign_compact_sk_check
+ *
+ * Description: Checks that a buffer, e.g. a mapped file, holds a complete
+ *              and uncorrupted compact secret key for this parameter set.
+ *              This should be called once after loading a compact key,
+ *              before using it.
+ *
+ * Arguments:   - const uint8_t *csk: pointer to compact secret key
+ *              - size_t len:         length of the buffer
+ *
+ * Returns 0 if the compact secret key is valid, and -1 otherwise
+ **************************************************/
+int crypto_sign_compact_sk_check(const uint8_t *csk, size_t len);
+
+#endif /* !MLD_EXPANDED_H */
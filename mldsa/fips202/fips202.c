@@ -9,6 +9,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "fips202.h"
 
@@ -29,6 +30,12 @@ __contract__(
   requires(memory_no_alias(x, sizeof(uint8_t) * 8))
 )
 {
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+  /* A single, possibly unaligned, 64-bit load */
+  uint64_t r;
+  memcpy(&r, x, 8);
+  return r;
+#else  /* MLD_SYS_LITTLE_ENDIAN */
   unsigned int i;
   uint64_t r = 0;
 
@@ -41,33 +48,7 @@ __contract__(
   }
 
   return r;
-}
-
-/*************************************************
- * Name:        store64
- *
- * Description: Store a 64-bit integer to array of 8 bytes in little-endian
- *order
- *
- * Arguments:   - uint8_t *x: pointer to the output byte array (allocated)
- *              - uint64_t u: input 64-bit unsigned integer
- **************************************************/
-static void store64(uint8_t x[8], uint64_t u)
-__contract__(
-  requires(memory_no_alias(x, sizeof(uint8_t) * 8))
-  assigns(memory_slice(x, sizeof(uint8_t) * 8))
-)
-{
-  unsigned int i;
-
-  for (i = 0; i < 8; i++)
-  __loop__(
-    invariant(i <= 8)
-  )
-  {
-    /* Explicitly truncate to uint8_t */
-    x[i] = (uint8_t)((u >> (8 * i)) & 0xFF);
-  }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
 }
 
 /* Keccak round constants */
@@ -85,11 +66,25 @@ const uint64_t KeccakF_RoundConstants[NROUNDS] = {
     (uint64_t)0x8000000080008081ULL, (uint64_t)0x8000000000008080ULL,
     (uint64_t)0x0000000080000001ULL, (uint64_t)0x8000000080008008ULL};
 
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+MLD_THREAD_LOCAL uint64_t mld_keccakf1600_permutations;
+#endif
+
 /*************************************************
  * Name:        KeccakF1600_StatePermute
  *
  * Description: The Keccak F1600 Permutation
  *
+ *              Rounds are processed in pairs, alternating between the A
+ *              and E lanes, so that no lanes need to be copied. The chi
+ *              step uses the lane complementing transform from the Keccak
+ *              implementation overview: six lanes are kept complemented
+ *              during the permutation, which turns all but one of the
+ *              five NOT operations of each row of chi into plain AND/OR.
+ *              This helps most on targets without an and-not instruction.
+ *              The complementing is applied on entry and undone on exit,
+ *              so the state in memory is the standard one.
+ *
  * Arguments:   - uint64_t *state: pointer to input/output Keccak state
  **************************************************/
 static void KeccakF1600_StatePermute(uint64_t state[MLD_KECCAK_LANES])
@@ -112,28 +107,33 @@ __contract__(
   uint64_t Ema, Eme, Emi, Emo, Emu;
   uint64_t Esa, Ese, Esi, Eso, Esu;
 
-  /* copyFromState(A, state) */
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+  mld_keccakf1600_permutations++;
+#endif
+
+  /* copyFromState(A, state), complementing the lanes at positions
+   * 1, 2, 8, 12, 17 and 20 */
   Aba = state[0];
-  Abe = state[1];
-  Abi = state[2];
+  Abe = ~state[1];
+  Abi = ~state[2];
   Abo = state[3];
   Abu = state[4];
   Aga = state[5];
   Age = state[6];
   Agi = state[7];
-  Ago = state[8];
+  Ago = ~state[8];
   Agu = state[9];
   Aka = state[10];
   Ake = state[11];
-  Aki = state[12];
+  Aki = ~state[12];
   Ako = state[13];
   Aku = state[14];
   Ama = state[15];
   Ame = state[16];
-  Ami = state[17];
+  Ami = ~state[17];
   Amo = state[18];
   Amu = state[19];
-  Asa = state[20];
+  Asa = ~state[20];
   Ase = state[21];
   Asi = state[22];
   Aso = state[23];
@@ -166,12 +166,12 @@ __contract__(
     BCo = ROL(Amo, 21);
     Asu ^= Du;
     BCu = ROL(Asu, 14);
-    Eba = BCa ^ ((~BCe) & BCi);
+    Eba = BCa ^ (BCe | BCi);
     Eba ^= (uint64_t)KeccakF_RoundConstants[round];
-    Ebe = BCe ^ ((~BCi) & BCo);
-    Ebi = BCi ^ ((~BCo) & BCu);
-    Ebo = BCo ^ ((~BCu) & BCa);
-    Ebu = BCu ^ ((~BCa) & BCe);
+    Ebe = BCe ^ ((~BCi) | BCo);
+    Ebi = BCi ^ (BCo & BCu);
+    Ebo = BCo ^ (BCu | BCa);
+    Ebu = BCu ^ (BCa & BCe);
 
     Abo ^= Do;
     BCa = ROL(Abo, 28);
@@ -183,11 +183,11 @@ __contract__(
     BCo = ROL(Ame, 45);
     Asi ^= Di;
     BCu = ROL(Asi, 61);
-    Ega = BCa ^ ((~BCe) & BCi);
-    Ege = BCe ^ ((~BCi) & BCo);
-    Egi = BCi ^ ((~BCo) & BCu);
-    Ego = BCo ^ ((~BCu) & BCa);
-    Egu = BCu ^ ((~BCa) & BCe);
+    Ega = BCa ^ (BCe | BCi);
+    Ege = BCe ^ (BCi & BCo);
+    Egi = BCi ^ (BCo | (~BCu));
+    Ego = BCo ^ (BCu | BCa);
+    Egu = BCu ^ (BCa & BCe);
 
     Abe ^= De;
     BCa = ROL(Abe, 1);
@@ -199,11 +199,11 @@ __contract__(
     BCo = ROL(Amu, 8);
     Asa ^= Da;
     BCu = ROL(Asa, 18);
-    Eka = BCa ^ ((~BCe) & BCi);
-    Eke = BCe ^ ((~BCi) & BCo);
+    Eka = BCa ^ (BCe | BCi);
+    Eke = BCe ^ (BCi & BCo);
     Eki = BCi ^ ((~BCo) & BCu);
-    Eko = BCo ^ ((~BCu) & BCa);
-    Eku = BCu ^ ((~BCa) & BCe);
+    Eko = (~BCo) ^ (BCu | BCa);
+    Eku = BCu ^ (BCa & BCe);
 
     Abu ^= Du;
     BCa = ROL(Abu, 27);
@@ -215,11 +215,11 @@ __contract__(
     BCo = ROL(Ami, 15);
     Aso ^= Do;
     BCu = ROL(Aso, 56);
-    Ema = BCa ^ ((~BCe) & BCi);
-    Eme = BCe ^ ((~BCi) & BCo);
-    Emi = BCi ^ ((~BCo) & BCu);
-    Emo = BCo ^ ((~BCu) & BCa);
-    Emu = BCu ^ ((~BCa) & BCe);
+    Ema = BCa ^ (BCe & BCi);
+    Eme = BCe ^ (BCi | BCo);
+    Emi = BCi ^ ((~BCo) | BCu);
+    Emo = (~BCo) ^ (BCu & BCa);
+    Emu = BCu ^ (BCa | BCe);
 
     Abi ^= Di;
     BCa = ROL(Abi, 62);
@@ -232,10 +232,10 @@ __contract__(
     Ase ^= De;
     BCu = ROL(Ase, 2);
     Esa = BCa ^ ((~BCe) & BCi);
-    Ese = BCe ^ ((~BCi) & BCo);
-    Esi = BCi ^ ((~BCo) & BCu);
-    Eso = BCo ^ ((~BCu) & BCa);
-    Esu = BCu ^ ((~BCa) & BCe);
+    Ese = (~BCe) ^ (BCi | BCo);
+    Esi = BCi ^ (BCo & BCu);
+    Eso = BCo ^ (BCu | BCa);
+    Esu = BCu ^ (BCa & BCe);
 
     /* prepareTheta */
     BCa = Eba ^ Ega ^ Eka ^ Ema ^ Esa;
@@ -261,12 +261,12 @@ __contract__(
     BCo = ROL(Emo, 21);
     Esu ^= Du;
     BCu = ROL(Esu, 14);
-    Aba = BCa ^ ((~BCe) & BCi);
+    Aba = BCa ^ (BCe | BCi);
     Aba ^= (uint64_t)KeccakF_RoundConstants[round + 1];
-    Abe = BCe ^ ((~BCi) & BCo);
-    Abi = BCi ^ ((~BCo) & BCu);
-    Abo = BCo ^ ((~BCu) & BCa);
-    Abu = BCu ^ ((~BCa) & BCe);
+    Abe = BCe ^ ((~BCi) | BCo);
+    Abi = BCi ^ (BCo & BCu);
+    Abo = BCo ^ (BCu | BCa);
+    Abu = BCu ^ (BCa & BCe);
 
     Ebo ^= Do;
     BCa = ROL(Ebo, 28);
@@ -278,11 +278,11 @@ __contract__(
     BCo = ROL(Eme, 45);
     Esi ^= Di;
     BCu = ROL(Esi, 61);
-    Aga = BCa ^ ((~BCe) & BCi);
-    Age = BCe ^ ((~BCi) & BCo);
-    Agi = BCi ^ ((~BCo) & BCu);
-    Ago = BCo ^ ((~BCu) & BCa);
-    Agu = BCu ^ ((~BCa) & BCe);
+    Aga = BCa ^ (BCe | BCi);
+    Age = BCe ^ (BCi & BCo);
+    Agi = BCi ^ (BCo | (~BCu));
+    Ago = BCo ^ (BCu | BCa);
+    Agu = BCu ^ (BCa & BCe);
 
     Ebe ^= De;
     BCa = ROL(Ebe, 1);
@@ -294,11 +294,11 @@ __contract__(
     BCo = ROL(Emu, 8);
     Esa ^= Da;
     BCu = ROL(Esa, 18);
-    Aka = BCa ^ ((~BCe) & BCi);
-    Ake = BCe ^ ((~BCi) & BCo);
+    Aka = BCa ^ (BCe | BCi);
+    Ake = BCe ^ (BCi & BCo);
     Aki = BCi ^ ((~BCo) & BCu);
-    Ako = BCo ^ ((~BCu) & BCa);
-    Aku = BCu ^ ((~BCa) & BCe);
+    Ako = (~BCo) ^ (BCu | BCa);
+    Aku = BCu ^ (BCa & BCe);
 
     Ebu ^= Du;
     BCa = ROL(Ebu, 27);
@@ -310,11 +310,11 @@ __contract__(
     BCo = ROL(Emi, 15);
     Eso ^= Do;
     BCu = ROL(Eso, 56);
-    Ama = BCa ^ ((~BCe) & BCi);
-    Ame = BCe ^ ((~BCi) & BCo);
-    Ami = BCi ^ ((~BCo) & BCu);
-    Amo = BCo ^ ((~BCu) & BCa);
-    Amu = BCu ^ ((~BCa) & BCe);
+    Ama = BCa ^ (BCe & BCi);
+    Ame = BCe ^ (BCi | BCo);
+    Ami = BCi ^ ((~BCo) | BCu);
+    Amo = (~BCo) ^ (BCu & BCa);
+    Amu = BCu ^ (BCa | BCe);
 
     Ebi ^= Di;
     BCa = ROL(Ebi, 62);
@@ -327,40 +327,45 @@ __contract__(
     Ese ^= De;
     BCu = ROL(Ese, 2);
     Asa = BCa ^ ((~BCe) & BCi);
-    Ase = BCe ^ ((~BCi) & BCo);
-    Asi = BCi ^ ((~BCo) & BCu);
-    Aso = BCo ^ ((~BCu) & BCa);
-    Asu = BCu ^ ((~BCa) & BCe);
+    Ase = (~BCe) ^ (BCi | BCo);
+    Asi = BCi ^ (BCo & BCu);
+    Aso = BCo ^ (BCu | BCa);
+    Asu = BCu ^ (BCa & BCe);
   }
 
-  /* copyToState(state, A) */
+  /* copyToState(state, A), undoing the complementing */
   state[0] = Aba;
-  state[1] = Abe;
-  state[2] = Abi;
+  state[1] = ~Abe;
+  state[2] = ~Abi;
   state[3] = Abo;
   state[4] = Abu;
   state[5] = Aga;
   state[6] = Age;
   state[7] = Agi;
-  state[8] = Ago;
+  state[8] = ~Ago;
   state[9] = Agu;
   state[10] = Aka;
   state[11] = Ake;
-  state[12] = Aki;
+  state[12] = ~Aki;
   state[13] = Ako;
   state[14] = Aku;
   state[15] = Ama;
   state[16] = Ame;
-  state[17] = Ami;
+  state[17] = ~Ami;
   state[18] = Amo;
   state[19] = Amu;
-  state[20] = Asa;
+  state[20] = ~Asa;
   state[21] = Ase;
   state[22] = Asi;
   state[23] = Aso;
   state[24] = Asu;
 }
 
+void mld_keccakf1600_permute(uint64_t state[MLD_KECCAK_LANES])
+{
+  KeccakF1600_StatePermute(state);
+}
+
 /*************************************************
  * Name:        keccak_init
  *
@@ -387,6 +392,83 @@ __contract__(
   cassert(forall(k, 0, MLD_KECCAK_LANES, s[k] == 0));
 }
 
+/*************************************************
+ * Name:        keccakf1600_xor_bytes
+ *
+ * Description: XORs a specified number of bytes from the provided data
+ *              buffer into the state buffer, starting at offset
+ *
+ * Arguments:   - uint64_t *state: pointer to the state array
+ *              - const unsigned char *data: pointer to the input byte array
+ *              - unsigned offset: starting byte position in the state
+ *              - unsigned length: number of bytes to XOR
+ **************************************************/
+static void keccakf1600_xor_bytes(uint64_t *state, const unsigned char *data,
+                                  unsigned offset, unsigned length)
+__contract__(
+  requires(0 <= offset && offset <= MLD_KECCAK_LANES * sizeof(uint64_t) &&
+      0 <= length && length <= MLD_KECCAK_LANES * sizeof(uint64_t) - offset)
+  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  requires(memory_no_alias(data, length))
+  assigns(memory_slice(state, sizeof(uint64_t) * MLD_KECCAK_LANES)))
+{
+  unsigned i;
+
+  /* Bytes up to the next lane boundary, then whole lanes, then the
+   * remaining bytes. Whole lanes are loaded with load64, which is a
+   * single 64-bit load on little-endian targets. */
+  for (i = 0; i < length && (offset + i) % 8 != 0; i++)
+  __loop__(invariant(i <= length))
+  {
+    state[(offset + i) / 8] ^= (uint64_t)data[i] << (8 * ((offset + i) % 8));
+  }
+  for (; i + 8 <= length; i += 8)
+  __loop__(invariant(i <= length))
+  {
+    state[(offset + i) / 8] ^= load64(data + i);
+  }
+  for (; i < length; i++)
+  __loop__(invariant(i <= length))
+  {
+    state[(offset + i) / 8] ^= (uint64_t)data[i] << (8 * ((offset + i) % 8));
+  }
+}
+
+/*************************************************
+ * Name:        keccakf1600_extract_bytes
+ *
+ * Description: Extracts a specified number of bytes from the state
+ *              buffer starting at offset and stores them in the provided
+ *              data buffer
+ *
+ * Arguments:   - uint64_t *state: pointer to the state array
+ *              - unsigned char *data: pointer to the output byte array
+ *(allocated)
+ *              - unsigned offset: starting byte position in the state
+ *              - unsigned length: number of bytes to extract
+ **************************************************/
+static void keccakf1600_extract_bytes(uint64_t *state, unsigned char *data,
+                                      unsigned offset, unsigned length)
+__contract__(
+  requires(0 <= offset && offset <= MLD_KECCAK_LANES * sizeof(uint64_t) &&
+      0 <= length && length <= MLD_KECCAK_LANES * sizeof(uint64_t) - offset)
+  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  requires(memory_no_alias(data, length))
+  assigns(memory_slice(data, length)))
+{
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+  memcpy(data, (uint8_t *)state + offset, length);
+#else  /* MLD_SYS_LITTLE_ENDIAN */
+  /* Portable version */
+  unsigned i;
+  for (i = 0; i < length; i++)
+  __loop__(invariant(i <= length))
+  {
+    data[i] = (state[(offset + i) >> 3] >> (8 * ((offset + i) & 0x07))) & 0xFF;
+  }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
+}
+
 /*************************************************
  * Name:        keccak_absorb
  *
@@ -411,38 +493,23 @@ __contract__(
   assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
   ensures(return_value < r))
 {
-  unsigned int i;
-
   while (pos + inlen >= r)
   __loop__(
-    assigns(pos, i, in, inlen,
+    assigns(pos, in, inlen,
       memory_slice(s, sizeof(uint64_t) *  MLD_KECCAK_LANES))
     invariant(inlen <= loop_entry(inlen))
     invariant(pos <= r)
     invariant(in == loop_entry(in) + (loop_entry(inlen) - inlen)))
   {
-    for (i = pos; i < r; i++)
-    __loop__(
-      assigns(i, in, memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES))
-      invariant(i >= pos && i <= r)
-      invariant(in == loop_entry(in) + (i - pos)))
-    {
-      s[i / 8] ^= (uint64_t)*in++ << 8 * (i % 8);
-    }
+    keccakf1600_xor_bytes(s, in, pos, r - pos);
+    in += r - pos;
     inlen -= r - pos;
     KeccakF1600_StatePermute(s);
     pos = 0;
   }
 
-  for (i = pos; i < pos + inlen; i++)
-  __loop__(
-    invariant(i >= pos && i - pos <= inlen)
-    invariant(in == loop_entry(in) + (i - pos)))
-  {
-    s[i / 8] ^= (uint64_t)*in++ << 8 * (i % 8);
-  }
-
-  return i;
+  keccakf1600_xor_bytes(s, in, pos, (unsigned)inlen);
+  return pos + (unsigned)inlen;
 }
 
 /*************************************************
@@ -497,13 +564,11 @@ __contract__(
   assigns(memory_slice(out, outlen))
   ensures(return_value <= r))
 {
-  unsigned int i;
-  uint64_t lane;
-  uint8_t byte;
+  unsigned int len;
 
   while (outlen > 0)
   __loop__(
-    assigns(i, outlen, pos, out, memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES), memory_slice(out, outlen))
+    assigns(len, outlen, pos, out, memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES), memory_slice(out, outlen))
     invariant(outlen <= loop_entry(outlen))
     invariant(out == loop_entry(out) + (loop_entry(outlen) - outlen))
     invariant(pos <= r)
@@ -514,19 +579,11 @@ __contract__(
       KeccakF1600_StatePermute(s);
       pos = 0;
     }
-    for (i = pos; i < r && i < pos + outlen; i++)
-    __loop__(
-      assigns(i, out, memory_slice(out, outlen))
-      invariant(i >= pos && i <= r && i <= pos + outlen)
-      invariant(out == loop_entry(out) + (i - pos))
-    )
-    {
-      lane = s[i / 8];
-      byte = (uint8_t)((lane >> (8 * (i % 8))) & 0xFF);
-      *out++ = byte;
-    }
-    outlen -= i - pos;
-    pos = i;
+    len = (outlen < r - pos) ? (unsigned int)outlen : r - pos;
+    keccakf1600_extract_bytes(s, out, pos, len);
+    out += len;
+    outlen -= len;
+    pos += len;
   }
 
   return pos;
@@ -567,66 +624,17 @@ __contract__(
     invariant(inlen <= loop_entry(inlen))
     invariant(in == loop_entry(in) + (loop_entry(inlen) - inlen)))
   {
-    for (i = 0; i < r / 8; i++)
-    __loop__(invariant(i <= r / 8))
-    {
-      s[i] ^= load64(in + 8 * i);
-    }
+    keccakf1600_xor_bytes(s, in, 0, r);
     in += r;
     inlen -= r;
     KeccakF1600_StatePermute(s);
   }
 
-  for (i = 0; i < inlen; i++)
-  __loop__(invariant(i <= inlen))
-  {
-    s[i / 8] ^= (uint64_t)in[i] << 8 * (i % 8);
-  }
-
-  s[i / 8] ^= (uint64_t)p << 8 * (i % 8);
+  keccakf1600_xor_bytes(s, in, 0, (unsigned)inlen);
+  s[inlen / 8] ^= (uint64_t)p << 8 * (inlen % 8);
   s[(r - 1) / 8] ^= 1ULL << 63;
 }
 
-/*************************************************
- * Name:        keccakf1600_extract_bytes
- *
- * Description: Extracts a specified number of bytes from the state
- *              buffer starting at offset and stores them in the provided
- *              data buffer
- *
- * Arguments:   - uint64_t *state: pointer to the state array
- *              - unsigned char *data: pointer to the output byte array
- *(allocated)
- *              - unsigned offset: starting byte position in the state
- *              - unsigned length: number of bytes to extract
- **************************************************/
-static void keccakf1600_extract_bytes(uint64_t *state, unsigned char *data,
-                                      unsigned offset, unsigned length)
-__contract__(
-  requires(0 <= offset && offset <= MLD_KECCAK_LANES * sizeof(uint64_t) &&
-      0 <= length && length <= MLD_KECCAK_LANES * sizeof(uint64_t) - offset)
-  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
-  requires(memory_no_alias(data, length))
-  assigns(memory_slice(data, length)))
-{
-  unsigned i;
-#if defined(MLD_SYS_LITTLE_ENDIAN)
-  uint8_t *state_ptr = (uint8_t *)state + offset;
-  for (i = 0; i < length; i++)
-  __loop__(invariant(i <= length))
-  {
-    data[i] = state_ptr[i];
-  }
-#else  /* MLD_SYS_LITTLE_ENDIAN */
-  /* Portable version */
-  for (i = 0; i < length; i++)
-  __loop__(invariant(i <= length))
-  {
-    data[i] = (state[(offset + i) >> 3] >> (8 * ((offset + i) & 0x07))) & 0xFF;
-  }
-#endif /* !MLD_SYS_LITTLE_ENDIAN */
-}
-
 /*************************************************
  * Name:        keccak_squeezeblocks
  *
@@ -907,16 +915,11 @@ void shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen)
  **************************************************/
 void sha3_256(uint8_t h[SHA3_256_HASHBYTES], const uint8_t *in, size_t inlen)
 {
-  unsigned int i;
   uint64_t s[MLD_KECCAK_LANES];
 
   keccak_absorb_once(s, SHA3_256_RATE, in, inlen, 0x06);
   KeccakF1600_StatePermute(s);
-  for (i = 0; i < 4; i++)
-  __loop__(invariant(i <= 4))
-  {
-    store64(h + 8 * i, s[i]);
-  }
+  keccakf1600_extract_bytes(s, h, 0, SHA3_256_HASHBYTES);
 }
 
 /*************************************************
@@ -930,14 +933,14 @@ void sha3_256(uint8_t h[SHA3_256_HASHBYTES], const uint8_t *in, size_t inlen)
  **************************************************/
 void sha3_512(uint8_t h[SHA3_512_HASHBYTES], const uint8_t *in, size_t inlen)
 {
-  unsigned int i;
   uint64_t s[MLD_KECCAK_LANES];
 
   keccak_absorb_once(s, SHA3_512_RATE, in, inlen, 0x06);
   KeccakF1600_StatePermute(s);
-  for (i = 0; i < 8; i++)
-  __loop__(invariant(i <= 8))
-  {
-    store64(h + 8 * i, s[i]);
-  }
+  keccakf1600_extract_bytes(s, h, 0, SHA3_512_HASHBYTES);
 }
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef NROUNDS
+#undef ROL
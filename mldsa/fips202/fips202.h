@@ -7,7 +7,17 @@
 
 #include <stddef.h>
 #include <stdint.h>
+
+#define FIPS202_NAMESPACE(s) mldsa_fips202_ref_##s
+
+/* Declared ahead of common.h: the x86_64 backend, which common.h pulls
+ * in, passes these to its permutation. */
+#define KeccakF_RoundConstants FIPS202_NAMESPACE(KeccakF_RoundConstants)
+extern const uint64_t KeccakF_RoundConstants[];
+
 #include "../cbmc.h"
+#include "../common.h"
+#include "../stats.h"
 
 #define SHAKE128_RATE 168
 #define SHAKE256_RATE 136
@@ -17,18 +27,37 @@
 #define SHA3_256_HASHBYTES 32
 #define SHA3_512_HASHBYTES 64
 
-#define FIPS202_NAMESPACE(s) mldsa_fips202_ref_##s
-
 typedef struct
 {
   uint64_t s[MLD_KECCAK_LANES];
   unsigned int pos;
 } keccak_state;
 
-#define KeccakF_RoundConstants FIPS202_NAMESPACE(KeccakF_RoundConstants)
-extern const uint64_t KeccakF_RoundConstants[];
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+/* Number of Keccak-f[1600] permutations performed by the calling thread;
+ * read through mld_stats_get(). */
+#define mld_keccakf1600_permutations \
+  FIPS202_NAMESPACE(keccakf1600_permutations)
+extern MLD_THREAD_LOCAL uint64_t mld_keccakf1600_permutations;
+#endif
+
+#define mld_keccakf1600_permute FIPS202_NAMESPACE(keccakf1600_permute)
+/*************************************************
+ * Name:        mld_keccakf1600_permute
+ *
+ * Description: The Keccak-f1600 permutation, applied in place.
+ *
+ * Arguments:   - uint64_t *state: pointer to input/output Keccak state
+ **************************************************/
+MLD_INTERNAL_API
+void mld_keccakf1600_permute(uint64_t state[MLD_KECCAK_LANES])
+__contract__(
+  requires(memory_no_alias(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+  assigns(memory_slice(state, sizeof(uint64_t) * MLD_KECCAK_LANES))
+);
 
 #define shake128_init FIPS202_NAMESPACE(shake128_init)
+MLD_INTERNAL_API
 void shake128_init(keccak_state *state)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -37,6 +66,7 @@ __contract__(
 );
 
 #define shake128_absorb FIPS202_NAMESPACE(shake128_absorb)
+MLD_INTERNAL_API
 void shake128_absorb(keccak_state *state, const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -47,6 +77,7 @@ __contract__(
 );
 
 #define shake128_finalize FIPS202_NAMESPACE(shake128_finalize)
+MLD_INTERNAL_API
 void shake128_finalize(keccak_state *state)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -56,6 +87,7 @@ __contract__(
 );
 
 #define shake128_squeeze FIPS202_NAMESPACE(shake128_squeeze)
+MLD_INTERNAL_API
 void shake128_squeeze(uint8_t *out, size_t outlen, keccak_state *state)
 __contract__(
   requires(outlen <= 8 * SHAKE128_RATE /* somewhat arbitrary bound */)
@@ -68,6 +100,7 @@ __contract__(
 );
 
 #define shake128_absorb_once FIPS202_NAMESPACE(shake128_absorb_once)
+MLD_INTERNAL_API
 void shake128_absorb_once(keccak_state *state, const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -77,6 +110,7 @@ __contract__(
 );
 
 #define shake128_squeezeblocks FIPS202_NAMESPACE(shake128_squeezeblocks)
+MLD_INTERNAL_API
 void shake128_squeezeblocks(uint8_t *out, size_t nblocks, keccak_state *state)
 __contract__(
   requires(nblocks <= 8 /* somewhat arbitrary bound */)
@@ -89,6 +123,7 @@ __contract__(
 );
 
 #define shake256_init FIPS202_NAMESPACE(shake256_init)
+MLD_INTERNAL_API
 void shake256_init(keccak_state *state)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -97,6 +132,7 @@ __contract__(
 );
 
 #define shake256_absorb FIPS202_NAMESPACE(shake256_absorb)
+MLD_INTERNAL_API
 void shake256_absorb(keccak_state *state, const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -107,6 +143,7 @@ __contract__(
 );
 
 #define shake256_finalize FIPS202_NAMESPACE(shake256_finalize)
+MLD_INTERNAL_API
 void shake256_finalize(keccak_state *state)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -116,6 +153,7 @@ __contract__(
 );
 
 #define shake256_squeeze FIPS202_NAMESPACE(shake256_squeeze)
+MLD_INTERNAL_API
 void shake256_squeeze(uint8_t *out, size_t outlen, keccak_state *state)
 __contract__(
   requires(outlen <= 8 * SHAKE256_RATE /* somewhat arbitrary bound */)
@@ -128,6 +166,7 @@ __contract__(
 );
 
 #define shake256_absorb_once FIPS202_NAMESPACE(shake256_absorb_once)
+MLD_INTERNAL_API
 void shake256_absorb_once(keccak_state *state, const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(state, sizeof(keccak_state)))
@@ -137,6 +176,7 @@ __contract__(
 );
 
 #define shake256_squeezeblocks FIPS202_NAMESPACE(shake256_squeezeblocks)
+MLD_INTERNAL_API
 void shake256_squeezeblocks(uint8_t *out, size_t nblocks, keccak_state *state)
 __contract__(
   requires(nblocks <= 8 /* somewhat arbitrary bound */)
@@ -149,6 +189,7 @@ __contract__(
 );
 
 #define shake128 FIPS202_NAMESPACE(shake128)
+MLD_INTERNAL_API
 void shake128(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen)
 __contract__(
   requires(outlen <= 8 * SHAKE128_RATE /* somewhat arbitrary bound */)
@@ -158,6 +199,7 @@ __contract__(
 );
 
 #define shake256 FIPS202_NAMESPACE(shake256)
+MLD_INTERNAL_API
 void shake256(uint8_t *out, size_t outlen, const uint8_t *in, size_t inlen)
 __contract__(
   requires(outlen <= 8 * SHAKE256_RATE /* somewhat arbitrary bound */)
@@ -167,6 +209,7 @@ __contract__(
 );
 
 #define sha3_256 FIPS202_NAMESPACE(sha3_256)
+MLD_INTERNAL_API
 void sha3_256(uint8_t h[SHA3_256_HASHBYTES], const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(in, inlen))
@@ -175,6 +218,7 @@ __contract__(
 );
 
 #define sha3_512 FIPS202_NAMESPACE(sha3_512)
+MLD_INTERNAL_API
 void sha3_512(uint8_t h[SHA3_512_HASHBYTES], const uint8_t *in, size_t inlen)
 __contract__(
   requires(memory_no_alias(in, inlen))
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fips202.h"
+#include "fips202x4.h"
+
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+/* With a native 8-way Keccak-f1600, the four instances run in lanes 0-3
+ * of its lane-interleaved state (see fips202x8.h); lanes 4-7 are idle.
+ * This is still far cheaper than four scalar permutations. */
+
+/*************************************************
+ * Name:        keccakx4_permute
+ *
+ * Description: Applies the Keccak-f1600 permutation to instances 0-3 of
+ *              the lane-interleaved state s. Must only be called if
+ *              mld_keccak_f1600_x8_native_available() returns 1.
+ *
+ * Arguments:   - uint64_t *s: pointer to the interleaved state
+ **************************************************/
+static void keccakx4_permute(uint64_t s[MLD_KECCAK_LANES * 8])
+__contract__(
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8))
+  assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8)))
+{
+  (void)mld_keccak_f1600_x8_native(s);
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+  mld_keccakf1600_permutations += 4;
+#endif
+}
+
+/*************************************************
+ * Name:        keccakx4_xor_bytes
+ *
+ * Description: XORs len bytes into the start of instance k of the
+ *              lane-interleaved state s.
+ *
+ * Arguments:   - uint64_t *s: pointer to the interleaved state
+ *              - unsigned k: instance index, 0 to 3
+ *              - const uint8_t *in: pointer to the input bytes
+ *              - unsigned len: number of bytes, at most 8 * MLD_KECCAK_LANES
+ **************************************************/
+static void keccakx4_xor_bytes(uint64_t s[MLD_KECCAK_LANES * 8], unsigned k,
+                               const uint8_t *in, unsigned len)
+__contract__(
+  requires(k < 4 && len <= 8 * MLD_KECCAK_LANES)
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8))
+  requires(memory_no_alias(in, len))
+  assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8)))
+{
+  unsigned i;
+  uint64_t t;
+
+  for (i = 0; i + 8 <= len; i += 8)
+  __loop__(invariant(i <= len))
+  {
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+    memcpy(&t, in + i, 8);
+#else
+    unsigned b;
+    t = 0;
+    for (b = 0; b < 8; b++)
+    __loop__(invariant(b <= 8))
+    {
+      t |= (uint64_t)in[i + b] << 8 * b;
+    }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
+    s[i + k] ^= t;
+  }
+  for (; i < len; i++)
+  __loop__(invariant(i <= len))
+  {
+    s[8 * (i / 8) + k] ^= (uint64_t)in[i] << 8 * (i % 8);
+  }
+}
+
+/*************************************************
+ * Name:        keccakx4_extract_bytes
+ *
+ * Description: Copies the first len bytes of instance k of the
+ *              lane-interleaved state s to out.
+ *
+ * Arguments:   - uint64_t *s: pointer to the interleaved state
+ *              - unsigned k: instance index, 0 to 3
+ *              - uint8_t *out: pointer to the output bytes
+ *              - unsigned len: number of bytes, at most 8 * MLD_KECCAK_LANES
+ **************************************************/
+static void keccakx4_extract_bytes(const uint64_t s[MLD_KECCAK_LANES * 8],
+                                   unsigned k, uint8_t *out, unsigned len)
+__contract__(
+  requires(k < 4 && len <= 8 * MLD_KECCAK_LANES)
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8))
+  requires(memory_no_alias(out, len))
+  assigns(memory_slice(out, len)))
+{
+  unsigned i;
+
+  for (i = 0; i + 8 <= len; i += 8)
+  __loop__(invariant(i <= len))
+  {
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+    memcpy(out + i, &s[i + k], 8);
+#else
+    unsigned b;
+    for (b = 0; b < 8; b++)
+    __loop__(invariant(b <= 8))
+    {
+      out[i + b] = (uint8_t)(s[i + k] >> 8 * b);
+    }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
+  }
+  for (; i < len; i++)
+  __loop__(invariant(i <= len))
+  {
+    out[i] = (uint8_t)(s[8 * (i / 8) + k] >> 8 * (i % 8));
+  }
+}
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+void mld_shake128x4_absorb_once(mld_shake128x4ctx *state, const uint8_t *in0,
+                                const uint8_t *in1, const uint8_t *in2,
+                                const uint8_t *in3, size_t inlen)
+{
+  shake128_absorb_once(&state->ctx[0], in0, inlen);
+  shake128_absorb_once(&state->ctx[1], in1, inlen);
+  shake128_absorb_once(&state->ctx[2], in2, inlen);
+  shake128_absorb_once(&state->ctx[3], in3, inlen);
+}
+
+void mld_shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                                  uint8_t *out3, size_t nblocks,
+                                  mld_shake128x4ctx *state)
+{
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+  if (mld_keccak_f1600_x8_native_available())
+  {
+    uint64_t s[MLD_KECCAK_LANES * 8] = {0};
+    unsigned i, j;
+
+    for (i = 0; i < 4; i++)
+    {
+      for (j = 0; j < MLD_KECCAK_LANES; j++)
+      {
+        s[8 * j + i] = state->ctx[i].s[j];
+      }
+    }
+    while (nblocks > 0)
+    {
+      keccakx4_permute(s);
+      keccakx4_extract_bytes(s, 0, out0, SHAKE128_RATE);
+      keccakx4_extract_bytes(s, 1, out1, SHAKE128_RATE);
+      keccakx4_extract_bytes(s, 2, out2, SHAKE128_RATE);
+      keccakx4_extract_bytes(s, 3, out3, SHAKE128_RATE);
+      out0 += SHAKE128_RATE;
+      out1 += SHAKE128_RATE;
+      out2 += SHAKE128_RATE;
+      out3 += SHAKE128_RATE;
+      nblocks--;
+    }
+    for (i = 0; i < 4; i++)
+    {
+      for (j = 0; j < MLD_KECCAK_LANES; j++)
+      {
+        state->ctx[i].s[j] = s[8 * j + i];
+      }
+    }
+    return;
+  }
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+  shake128_squeezeblocks(out0, nblocks, &state->ctx[0]);
+  shake128_squeezeblocks(out1, nblocks, &state->ctx[1]);
+  shake128_squeezeblocks(out2, nblocks, &state->ctx[2]);
+  shake128_squeezeblocks(out3, nblocks, &state->ctx[3]);
+}
+
+void mld_shake256x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                    size_t outlen, const uint8_t *in0, const uint8_t *in1,
+                    const uint8_t *in2, const uint8_t *in3, size_t inlen)
+{
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+  if (mld_keccak_f1600_x8_native_available())
+  {
+    uint64_t s[MLD_KECCAK_LANES * 8] = {0};
+    unsigned k, len;
+
+    /* Absorb, as keccak_absorb_once() in fips202.c */
+    while (inlen >= SHAKE256_RATE)
+    {
+      keccakx4_xor_bytes(s, 0, in0, SHAKE256_RATE);
+      keccakx4_xor_bytes(s, 1, in1, SHAKE256_RATE);
+      keccakx4_xor_bytes(s, 2, in2, SHAKE256_RATE);
+      keccakx4_xor_bytes(s, 3, in3, SHAKE256_RATE);
+      keccakx4_permute(s);
+      in0 += SHAKE256_RATE;
+      in1 += SHAKE256_RATE;
+      in2 += SHAKE256_RATE;
+      in3 += SHAKE256_RATE;
+      inlen -= SHAKE256_RATE;
+    }
+    keccakx4_xor_bytes(s, 0, in0, (unsigned)inlen);
+    keccakx4_xor_bytes(s, 1, in1, (unsigned)inlen);
+    keccakx4_xor_bytes(s, 2, in2, (unsigned)inlen);
+    keccakx4_xor_bytes(s, 3, in3, (unsigned)inlen);
+    for (k = 0; k < 4; k++)
+    {
+      s[8 * (inlen / 8) + k] ^= (uint64_t)0x1F << 8 * (inlen % 8);
+      s[8 * ((SHAKE256_RATE - 1) / 8) + k] ^= 1ULL << 63;
+    }
+
+    /* Squeeze */
+    while (outlen > 0)
+    {
+      keccakx4_permute(s);
+      len = outlen < SHAKE256_RATE ? (unsigned)outlen : SHAKE256_RATE;
+      keccakx4_extract_bytes(s, 0, out0, len);
+      keccakx4_extract_bytes(s, 1, out1, len);
+      keccakx4_extract_bytes(s, 2, out2, len);
+      keccakx4_extract_bytes(s, 3, out3, len);
+      out0 += len;
+      out1 += len;
+      out2 += len;
+      out3 += len;
+      outlen -= len;
+    }
+    return;
+  }
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+  shake256(out0, outlen, in0, inlen);
+  shake256(out1, outlen, in1, inlen);
+  shake256(out2, outlen, in2, inlen);
+  shake256(out3, outlen, in3, inlen);
+}
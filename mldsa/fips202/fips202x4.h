@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_FIPS202X4_H
+#define MLD_FIPS202_FIPS202X4_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cbmc.h"
+#include "../common.h"
+#include "fips202.h"
+
+/* Four independent SHAKE128 instances, processed together.
+ *
+ * The portable implementation processes the instances one after the
+ * other. With a native 8-way Keccak-f1600 (see MLD_USE_FIPS202_X8_NATIVE),
+ * the four instances run in parallel in four of its eight lanes. */
+typedef struct
+{
+  keccak_state ctx[4];
+} mld_shake128x4ctx;
+
+#define mld_shake128x4_absorb_once FIPS202_NAMESPACE(shake128x4_absorb_once)
+/*************************************************
+ * Name:        mld_shake128x4_absorb_once
+ *
+ * Description: Initializes four SHAKE128 instances and absorbs one
+ *              input of length inlen into each of them.
+ *
+ * Arguments:   - mld_shake128x4ctx *state: pointer to output state
+ *              - const uint8_t *in0, ..., *in3: pointers to the inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+MLD_INTERNAL_API
+void mld_shake128x4_absorb_once(mld_shake128x4ctx *state, const uint8_t *in0,
+                                const uint8_t *in1, const uint8_t *in2,
+                                const uint8_t *in3, size_t inlen)
+__contract__(
+  requires(memory_no_alias(state, sizeof(mld_shake128x4ctx)))
+  requires(memory_no_alias(in0, inlen))
+  requires(memory_no_alias(in1, inlen))
+  requires(memory_no_alias(in2, inlen))
+  requires(memory_no_alias(in3, inlen))
+  assigns(memory_slice(state, sizeof(mld_shake128x4ctx)))
+  ensures(state->ctx[0].pos == SHAKE128_RATE)
+  ensures(state->ctx[1].pos == SHAKE128_RATE)
+  ensures(state->ctx[2].pos == SHAKE128_RATE)
+  ensures(state->ctx[3].pos == SHAKE128_RATE)
+);
+
+#define mld_shake128x4_squeezeblocks \
+  FIPS202_NAMESPACE(shake128x4_squeezeblocks)
+/*************************************************
+ * Name:        mld_shake128x4_squeezeblocks
+ *
+ * Description: Squeezes nblocks blocks of SHAKE128_RATE bytes from each of
+ *              the four SHAKE128 instances.
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to the outputs
+ *              - size_t nblocks: number of blocks per output
+ *              - mld_shake128x4ctx *state: pointer to input/output state
+ **************************************************/
+MLD_INTERNAL_API
+void mld_shake128x4_squeezeblocks(uint8_t *out0, uint8_t *out1, uint8_t *out2,
+                                  uint8_t *out3, size_t nblocks,
+                                  mld_shake128x4ctx *state)
+__contract__(
+  requires(nblocks <= 8 /* somewhat arbitrary bound */)
+  requires(memory_no_alias(state, sizeof(mld_shake128x4ctx)))
+  requires(memory_no_alias(out0, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out1, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out2, nblocks * SHAKE128_RATE))
+  requires(memory_no_alias(out3, nblocks * SHAKE128_RATE))
+  requires(state->ctx[0].pos <= SHAKE128_RATE)
+  requires(state->ctx[1].pos <= SHAKE128_RATE)
+  requires(state->ctx[2].pos <= SHAKE128_RATE)
+  requires(state->ctx[3].pos <= SHAKE128_RATE)
+  assigns(memory_slice(state, sizeof(mld_shake128x4ctx)))
+  assigns(memory_slice(out0, nblocks * SHAKE128_RATE))
+  assigns(memory_slice(out1, nblocks * SHAKE128_RATE))
+  assigns(memory_slice(out2, nblocks * SHAKE128_RATE))
+  assigns(memory_slice(out3, nblocks * SHAKE128_RATE))
+  ensures(state->ctx[0].pos <= SHAKE128_RATE)
+  ensures(state->ctx[1].pos <= SHAKE128_RATE)
+  ensures(state->ctx[2].pos <= SHAKE128_RATE)
+  ensures(state->ctx[3].pos <= SHAKE128_RATE)
+);
+
+#define mld_shake256x4 FIPS202_NAMESPACE(shake256x4)
+/*************************************************
+ * Name:        mld_shake256x4
+ *
+ * Description: Computes SHAKE256 of four inputs of length inlen each,
+ *              writing outlen bytes to each output; equivalent to four
+ *              calls to shake256().
+ *
+ * Arguments:   - uint8_t *out0, ..., *out3: pointers to the outputs
+ *              - size_t outlen: length of each output in bytes
+ *              - const uint8_t *in0, ..., *in3: pointers to the inputs
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+MLD_INTERNAL_API
+void mld_shake256x4(uint8_t *out0, uint8_t *out1, uint8_t *out2, uint8_t *out3,
+                    size_t outlen, const uint8_t *in0, const uint8_t *in1,
+                    const uint8_t *in2, const uint8_t *in3, size_t inlen)
+__contract__(
+  requires(outlen <= 8 * SHAKE256_RATE /* somewhat arbitrary bound */)
+  requires(memory_no_alias(in0, inlen))
+  requires(memory_no_alias(in1, inlen))
+  requires(memory_no_alias(in2, inlen))
+  requires(memory_no_alias(in3, inlen))
+  requires(memory_no_alias(out0, outlen))
+  requires(memory_no_alias(out1, outlen))
+  requires(memory_no_alias(out2, outlen))
+  requires(memory_no_alias(out3, outlen))
+  assigns(memory_slice(out0, outlen))
+  assigns(memory_slice(out1, outlen))
+  assigns(memory_slice(out2, outlen))
+  assigns(memory_slice(out3, outlen))
+);
+
+#endif /* !MLD_FIPS202_FIPS202X4_H */
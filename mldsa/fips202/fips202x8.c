@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fips202.h"
+#include "fips202x8.h"
+
+/*************************************************
+ * Name:        keccakx8_permute
+ *
+ * Description: Applies the Keccak-f1600 permutation to the eight
+ *              lane-interleaved states, using the native backend if
+ *              available.
+ *
+ * Arguments:   - uint64_t *s: pointer to the eight input/output states
+ **************************************************/
+static void keccakx8_permute(uint64_t s[MLD_KECCAK_LANES * 8])
+__contract__(
+  requires(memory_no_alias(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8))
+  assigns(memory_slice(s, sizeof(uint64_t) * MLD_KECCAK_LANES * 8)))
+{
+  unsigned i, j;
+  uint64_t t[MLD_KECCAK_LANES];
+
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+  if (mld_keccak_f1600_x8_native(s) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+    mld_keccakf1600_permutations += 8;
+#endif
+    return;
+  }
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+  for (i = 0; i < 8; i++)
+  __loop__(invariant(i <= 8))
+  {
+    for (j = 0; j < MLD_KECCAK_LANES; j++)
+    __loop__(invariant(j <= MLD_KECCAK_LANES))
+    {
+      t[j] = s[8 * j + i];
+    }
+    mld_keccakf1600_permute(t);
+    for (j = 0; j < MLD_KECCAK_LANES; j++)
+    __loop__(invariant(j <= MLD_KECCAK_LANES))
+    {
+      s[8 * j + i] = t[j];
+    }
+  }
+}
+
+/*************************************************
+ * Name:        store64
+ *
+ * Description: Store a 64-bit integer to array of 8 bytes in little-endian
+ *              order
+ *
+ * Arguments:   - uint8_t *x: pointer to the output byte array (allocated)
+ *              - uint64_t u: input 64-bit unsigned integer
+ **************************************************/
+static void store64(uint8_t x[8], uint64_t u)
+__contract__(
+  requires(memory_no_alias(x, sizeof(uint8_t) * 8))
+  assigns(memory_slice(x, sizeof(uint8_t) * 8))
+)
+{
+#if defined(MLD_SYS_LITTLE_ENDIAN)
+  memcpy(x, &u, 8);
+#else  /* MLD_SYS_LITTLE_ENDIAN */
+  unsigned int i;
+  for (i = 0; i < 8; i++)
+  __loop__(invariant(i <= 8))
+  {
+    x[i] = (uint8_t)(u >> 8 * i);
+  }
+#endif /* !MLD_SYS_LITTLE_ENDIAN */
+}
+
+void mld_shake128x8_absorb_once(mld_shake128x8ctx *state, const uint8_t *in,
+                                size_t inlen)
+{
+  unsigned i, j;
+  keccak_state t;
+
+  /* Absorbing is cheap compared to squeezing for the short inputs used
+   * here, so each instance is absorbed by the scalar code and then moved
+   * into its lanes of the interleaved state. */
+  for (i = 0; i < 8; i++)
+  __loop__(invariant(i <= 8))
+  {
+    shake128_absorb_once(&t, in + i * inlen, inlen);
+    for (j = 0; j < MLD_KECCAK_LANES; j++)
+    __loop__(invariant(j <= MLD_KECCAK_LANES))
+    {
+      state->s[8 * j + i] = t.s[j];
+    }
+  }
+}
+
+void mld_shake128x8_squeezeblocks(uint8_t *out, size_t outstride,
+                                  size_t nblocks, mld_shake128x8ctx *state)
+{
+  unsigned i, j;
+
+  while (nblocks > 0)
+  __loop__(
+    assigns(i, j, out, nblocks,
+      memory_slice(state, sizeof(mld_shake128x8ctx)),
+      memory_slice(out, 7 * outstride + nblocks * SHAKE128_RATE))
+    invariant(nblocks <= loop_entry(nblocks))
+    invariant(out == loop_entry(out) +
+      SHAKE128_RATE * (loop_entry(nblocks) - nblocks))
+  )
+  {
+    keccakx8_permute(state->s);
+    /* SHAKE128_RATE is a whole number of lanes */
+    for (i = 0; i < 8; i++)
+    __loop__(invariant(i <= 8))
+    {
+      for (j = 0; j < SHAKE128_RATE / 8; j++)
+      __loop__(invariant(j <= SHAKE128_RATE / 8))
+      {
+        store64(out + i * outstride + 8 * j, state->s[8 * j + i]);
+      }
+    }
+    out += SHAKE128_RATE;
+    nblocks -= 1;
+  }
+}
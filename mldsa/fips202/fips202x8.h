@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_FIPS202_FIPS202X8_H
+#define MLD_FIPS202_FIPS202X8_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cbmc.h"
+#include "../common.h"
+#include "fips202.h"
+
+/* Eight independent SHAKE128 instances, processed together.
+ *
+ * The states are lane-interleaved: lane j of instance i is stored at
+ * s[8 * j + i]. This is the layout expected by 8-way vectorized
+ * Keccak-f1600 backends (see native/api.h). Without such a backend, or
+ * on hosts where it is unavailable, the instances are permuted one after
+ * the other. */
+typedef struct
+{
+  uint64_t s[MLD_KECCAK_LANES * 8];
+} mld_shake128x8ctx;
+
+#define mld_shake128x8_absorb_once FIPS202_NAMESPACE(shake128x8_absorb_once)
+/*************************************************
+ * Name:        mld_shake128x8_absorb_once
+ *
+ * Description: Initializes eight SHAKE128 instances and absorbs one
+ *              input of length inlen into each of them.
+ *
+ * Arguments:   - mld_shake128x8ctx *state: pointer to output state
+ *              - const uint8_t *in: pointer to the eight inputs, stored
+ *                back to back
+ *              - size_t inlen: length of each input in bytes
+ **************************************************/
+MLD_INTERNAL_API
+void mld_shake128x8_absorb_once(mld_shake128x8ctx *state, const uint8_t *in,
+                                size_t inlen)
+__contract__(
+  requires(inlen <= 8 * SHAKE128_RATE /* somewhat arbitrary bound */)
+  requires(memory_no_alias(state, sizeof(mld_shake128x8ctx)))
+  requires(memory_no_alias(in, 8 * inlen))
+  assigns(memory_slice(state, sizeof(mld_shake128x8ctx)))
+);
+
+#define mld_shake128x8_squeezeblocks \
+  FIPS202_NAMESPACE(shake128x8_squeezeblocks)
+/*************************************************
+ * Name:        mld_shake128x8_squeezeblocks
+ *
+ * Description: Squeezes nblocks blocks of SHAKE128_RATE bytes from each of
+ *              the eight SHAKE128 instances.
+ *
+ * Arguments:   - uint8_t *out: pointer to the outputs; the output of
+ *                instance i starts at out + i * outstride
+ *              - size_t outstride: distance between the outputs in bytes
+ *              - size_t nblocks: number of blocks per output
+ *              - mld_shake128x8ctx *state: pointer to input/output state
+ **************************************************/
+MLD_INTERNAL_API
+void mld_shake128x8_squeezeblocks(uint8_t *out, size_t outstride,
+                                  size_t nblocks, mld_shake128x8ctx *state)
+__contract__(
+  requires(nblocks <= 8 /* somewhat arbitrary bound */)
+  requires(outstride <= 8 * SHAKE128_RATE /* somewhat arbitrary bound */)
+  requires(nblocks * SHAKE128_RATE <= outstride)
+  requires(memory_no_alias(state, sizeof(mld_shake128x8ctx)))
+  requires(memory_no_alias(out, 7 * outstride + nblocks * SHAKE128_RATE))
+  assigns(memory_slice(state, sizeof(mld_shake128x8ctx)))
+  assigns(memory_slice(out, 7 * outstride + nblocks * SHAKE128_RATE))
+);
+
+#endif /* !MLD_FIPS202_FIPS202X8_H */
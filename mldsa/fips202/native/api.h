@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024-2025 The mlkem-native project authors
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_FIPS202_NATIVE_API_H
+#define MLD_FIPS202_NATIVE_API_H
+/*
+ * FIPS-202 native interface
+ *
+ * This header is primarily for documentation purposes.
+ * It should not be included by backend implementations.
+ */
+
+#include <stdint.h>
+#include "../../cbmc.h"
+#include "../../common.h"
+
+/*
+ * This is the C<->native interface allowing for the drop-in of
+ * native code for performance critical components of FIPS-202.
+ *
+ * To add a function to a backend, define MLD_USE_FIPS202_XXX_NATIVE and
+ * implement `static inline xxx(...)` in the profile header.
+ *
+ * As for the arithmetic backends (see native/api.h), native functions
+ * return MLD_NATIVE_FUNC_SUCCESS or, if they cannot handle the call,
+ * MLD_NATIVE_FUNC_FALLBACK, in which case the C code is used instead.
+ */
+
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+/*************************************************
+ * Name:        mld_keccak_f1600_x8_native
+ *
+ * Description: Applies the Keccak-f1600 permutation to eight
+ *              independent states in place.
+ *
+ *              The states are lane-interleaved: lane j of state i is
+ *              stored at state[8 * j + i].
+ *
+ * Arguments:   - uint64_t *state: pointer to the eight input/output states
+ *
+ * Return:      - MLD_NATIVE_FUNC_SUCCESS if the permutations were
+ *                computed, MLD_NATIVE_FUNC_FALLBACK otherwise, in which
+ *                case state is unmodified.
+ **************************************************/
+static MLD_INLINE int mld_keccak_f1600_x8_native(uint64_t *state)
+__contract__(
+  requires(memory_no_alias(state, sizeof(uint64_t) * 25 * 8))
+  assigns(memory_slice(state, sizeof(uint64_t) * 25 * 8))
+  ensures(return_value == MLD_NATIVE_FUNC_SUCCESS ||
+          return_value == MLD_NATIVE_FUNC_FALLBACK)
+);
+
+/*************************************************
+ * Name:        mld_keccak_f1600_x8_native_available
+ *
+ * Description: Reports whether mld_keccak_f1600_x8_native() will succeed
+ *              on this host.
+ *
+ *              Callers use this to choose between 8-way and narrower
+ *              batching: when the native permutation falls back, the
+ *              8-way C path only adds (de)interleaving on top of the
+ *              scalar permutation.
+ *
+ * Return:      - 1 if mld_keccak_f1600_x8_native() returns
+ *                MLD_NATIVE_FUNC_SUCCESS, 0 otherwise.
+ **************************************************/
+static MLD_INLINE int mld_keccak_f1600_x8_native_available(void)
+__contract__(
+  ensures(return_value == 0 || return_value == 1)
+);
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+#endif /* !MLD_FIPS202_NATIVE_API_H */
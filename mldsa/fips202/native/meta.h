@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024-2025 The mlkem-native project authors
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_FIPS202_NATIVE_META_H
+#define MLD_FIPS202_NATIVE_META_H
+
+/*
+ * Default FIPS-202 backend
+ */
+#include "../../sys.h"
+
+/* The x86_64 backend uses the System V calling convention */
+#if defined(MLD_SYS_X86_64) && !defined(MLD_SYS_WINDOWS)
+#include "x86_64/meta.h"
+#endif
+
+#endif /* !MLD_FIPS202_NATIVE_META_H */
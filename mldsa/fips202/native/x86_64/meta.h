@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_FIPS202_NATIVE_X86_64_META_H
+#define MLD_FIPS202_NATIVE_X86_64_META_H
+
+/* Set of primitives that this backend replaces */
+#define MLD_USE_FIPS202_X8_NATIVE
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLD_FIPS202_BACKEND_X86_64_AVX512
+
+#if !defined(__ASSEMBLER__)
+#include "src/fips202_native_x86_64.h"
+
+/* AVX-512 is optional, so this falls back to the C code on hosts
+ * without it. */
+static MLD_INLINE int mld_keccak_f1600_x8_native_available(void)
+{
+  return mld_sys_check_capability(MLD_SYS_CAP_AVX512) ? 1 : 0;
+}
+
+static MLD_INLINE int mld_keccak_f1600_x8_native(uint64_t *state)
+{
+  if (!mld_keccak_f1600_x8_native_available())
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_keccak_f1600_x8_avx512_asm(state, KeccakF_RoundConstants);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_FIPS202_NATIVE_X86_64_META_H */
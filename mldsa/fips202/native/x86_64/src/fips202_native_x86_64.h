@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H
+#define MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H
+
+#include <stdint.h>
+#include "../../../../common.h"
+/* For KeccakF_RoundConstants, shared with the C permutation */
+#include "../../../fips202.h"
+
+#define mld_keccak_f1600_x8_avx512_asm \
+  MLD_NAMESPACE_SHARED(keccak_f1600_x8_avx512_asm)
+void mld_keccak_f1600_x8_avx512_asm(uint64_t *, const uint64_t *);
+
+#endif /* !MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H */
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NOTE: You can remove this file unless you compile with MLD_CONFIG_KEYPOOL. */
+
+#include "common.h"
+
+#if defined(MLD_CONFIG_KEYPOOL) && !defined(CBMC)
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "keypool.h"
+#include "sign.h"
+
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mld_keypool_lock MLD_NAMESPACE(keypool_lock)
+#define mld_keypool_cond MLD_NAMESPACE(keypool_cond)
+#define mld_keypool_thread MLD_NAMESPACE(keypool_thread)
+#define mld_keypool_pk MLD_NAMESPACE(keypool_pk)
+#define mld_keypool_sk MLD_NAMESPACE(keypool_sk)
+#define mld_keypool_count MLD_NAMESPACE(keypool_count)
+#define mld_keypool_capacity MLD_NAMESPACE(keypool_capacity)
+#define mld_keypool_active MLD_NAMESPACE(keypool_active)
+#define mld_keypool_stop MLD_NAMESPACE(keypool_stop)
+#define mld_keypool_wipe MLD_NAMESPACE(keypool_wipe)
+#define mld_keypool_refill MLD_NAMESPACE(keypool_refill)
+/* End of static namespacing */
+
+/* The lock protects all of the state below except mld_keypool_thread
+ * and mld_keypool_active, which are only accessed by
+ * crypto_sign_keypool_init() and crypto_sign_keypool_free(). The
+ * condition variable is signalled when key pairs are taken out of the
+ * pool and when the refill thread is asked to stop. */
+static pthread_mutex_t mld_keypool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mld_keypool_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t mld_keypool_thread;
+static uint8_t *mld_keypool_pk = NULL;
+static uint8_t *mld_keypool_sk = NULL;
+static size_t mld_keypool_count = 0;
+static size_t mld_keypool_capacity = 0;
+static int mld_keypool_active = 0;
+static int mld_keypool_stop = 0;
+
+/* Zeroize secret key material; the volatile access keeps the compiler
+ * from eliding the stores. */
+static void mld_keypool_wipe(uint8_t *p, size_t len)
+{
+  volatile uint8_t *v = p;
+  while (len-- > 0)
+  {
+    *v++ = 0;
+  }
+}
+
+static void *mld_keypool_refill(void *arg)
+{
+  uint8_t pk[4 * CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[4 * CRYPTO_SECRETKEYBYTES];
+  size_t n;
+  (void)arg;
+
+  pthread_mutex_lock(&mld_keypool_lock);
+  while (!mld_keypool_stop)
+  {
+    if (mld_keypool_count == mld_keypool_capacity)
+    {
+      pthread_cond_wait(&mld_keypool_cond, &mld_keypool_lock);
+      continue;
+    }
+
+    /* Only this thread adds key pairs, so the free space can only grow
+     * while the lock is released. */
+    n = mld_keypool_capacity - mld_keypool_count;
+    n = (n < 4) ? n : 4;
+    pthread_mutex_unlock(&mld_keypool_lock);
+
+    crypto_sign_keypair_batch(pk, sk, n);
+
+    pthread_mutex_lock(&mld_keypool_lock);
+    memcpy(mld_keypool_pk + mld_keypool_count * CRYPTO_PUBLICKEYBYTES, pk,
+           n * CRYPTO_PUBLICKEYBYTES);
+    memcpy(mld_keypool_sk + mld_keypool_count * CRYPTO_SECRETKEYBYTES, sk,
+           n * CRYPTO_SECRETKEYBYTES);
+    mld_keypool_count += n;
+  }
+  pthread_mutex_unlock(&mld_keypool_lock);
+
+  mld_keypool_wipe(sk, sizeof(sk));
+  return NULL;
+}
+
+int crypto_sign_keypool_init(size_t capacity)
+{
+  uint8_t *pk, *sk;
+
+  if (mld_keypool_active || capacity == 0 ||
+      capacity > SIZE_MAX / CRYPTO_SECRETKEYBYTES)
+  {
+    return -1;
+  }
+
+  pk = malloc(capacity * CRYPTO_PUBLICKEYBYTES);
+  sk = malloc(capacity * CRYPTO_SECRETKEYBYTES);
+  if (pk == NULL || sk == NULL)
+  {
+    free(pk);
+    free(sk);
+    return -1;
+  }
+
+  pthread_mutex_lock(&mld_keypool_lock);
+  mld_keypool_pk = pk;
+  mld_keypool_sk = sk;
+  mld_keypool_count = 0;
+  mld_keypool_capacity = capacity;
+  mld_keypool_stop = 0;
+  pthread_mutex_unlock(&mld_keypool_lock);
+
+  if (pthread_create(&mld_keypool_thread, NULL, mld_keypool_refill, NULL) !=
+      0)
+  {
+    pthread_mutex_lock(&mld_keypool_lock);
+    mld_keypool_pk = NULL;
+    mld_keypool_sk = NULL;
+    mld_keypool_capacity = 0;
+    pthread_mutex_unlock(&mld_keypool_lock);
+    free(pk);
+    free(sk);
+    return -1;
+  }
+
+  mld_keypool_active = 1;
+  return 0;
+}
+
+int crypto_sign_keypool_pop(uint8_t *pk, uint8_t *sk)
+{
+  uint8_t *slot;
+  int pooled = 0;
+
+  pthread_mutex_lock(&mld_keypool_lock);
+  if (mld_keypool_count > 0)
+  {
+    mld_keypool_count--;
+    slot = mld_keypool_sk + mld_keypool_count * CRYPTO_SECRETKEYBYTES;
+    memcpy(pk, mld_keypool_pk + mld_keypool_count * CRYPTO_PUBLICKEYBYTES,
+           CRYPTO_PUBLICKEYBYTES);
+    memcpy(sk, slot, CRYPTO_SECRETKEYBYTES);
+    mld_keypool_wipe(slot, CRYPTO_SECRETKEYBYTES);
+    pthread_cond_signal(&mld_keypool_cond);
+    pooled = 1;
+  }
+  pthread_mutex_unlock(&mld_keypool_lock);
+
+  if (!pooled)
+  {
+    return crypto_sign_keypair(pk, sk);
+  }
+  return 0;
+}
+
+void crypto_sign_keypool_free(void)
+{
+  if (!mld_keypool_active)
+  {
+    return;
+  }
+
+  pthread_mutex_lock(&mld_keypool_lock);
+  mld_keypool_stop = 1;
+  pthread_cond_signal(&mld_keypool_cond);
+  pthread_mutex_unlock(&mld_keypool_lock);
+  pthread_join(mld_keypool_thread, NULL);
+
+  pthread_mutex_lock(&mld_keypool_lock);
+  mld_keypool_wipe(mld_keypool_sk,
+                   mld_keypool_capacity * CRYPTO_SECRETKEYBYTES);
+  free(mld_keypool_pk);
+  free(mld_keypool_sk);
+  mld_keypool_pk = NULL;
+  mld_keypool_sk = NULL;
+  mld_keypool_count = 0;
+  mld_keypool_capacity = 0;
+  pthread_mutex_unlock(&mld_keypool_lock);
+
+  mld_keypool_active = 0;
+}
+
+#else /* MLD_CONFIG_KEYPOOL && !CBMC */
+
+MLD_EMPTY_CU(keypool)
+
+#endif /* !(MLD_CONFIG_KEYPOOL && !CBMC) */
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef mld_keypool_lock
+#undef mld_keypool_cond
+#undef mld_keypool_thread
+#undef mld_keypool_pk
+#undef mld_keypool_sk
+#undef mld_keypool_count
+#undef mld_keypool_capacity
+#undef mld_keypool_active
+#undef mld_keypool_stop
+#undef mld_keypool_wipe
+#undef mld_keypool_refill
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_KEYPOOL_H
+#define MLD_KEYPOOL_H
+#include "common.h"
+
+#if defined(MLD_CONFIG_KEYPOOL) && !defined(CBMC)
+#include <stddef.h>
+#include <stdint.h>
+
+#define crypto_sign_keypool_init MLD_NAMESPACE(keypool_init)
+/*************************************************
+ * Name:        crypto_sign_keypool_init
+ *
+ * Description: Sets up a pool of up to capacity pre-generated key pairs
+ *              and starts a background thread keeping it filled.
+ *
+ *              The thread generates key pairs in groups of four via
+ *              crypto_sign_keypair_batch, and sleeps while the pool is
+ *              full, so that key generation can be moved off the latency
+ *              critical path of applications issuing keys on demand.
+ *
+ *              There is one pool per parameter set and process.
+ *
+ * Arguments:   - size_t capacity: maximum number of pooled key pairs
+ *
+ * Returns 0 on success, and -1 if the pool is already set up, capacity
+ * is 0, or memory or the thread could not be allocated.
+ **************************************************/
+int crypto_sign_keypool_init(size_t capacity);
+
+#define crypto_sign_keypool_pop MLD_NAMESPACE(keypool_pop)
+/*************************************************
+ * Name:        crypto_sign_keypool_pop
+ *
+ * Description: Takes a key pair out of the pool. If the pool is empty
+ *              or not set up, the key pair is generated by the calling
+ *              thread via crypto_sign_keypair.
+ *
+ *              Key pairs are removed from the pool as they are handed
+ *              out, so no key pair is returned twice.
+ *
+ * Arguments:   - uint8_t *pk: pointer to output public key (allocated
+ *                             array of CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk: pointer to output private key (allocated
+ *                             array of CRYPTO_SECRETKEYBYTES bytes)
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_keypool_pop(uint8_t *pk, uint8_t *sk);
+
+#define crypto_sign_keypool_free MLD_NAMESPACE(keypool_free)
+/*************************************************
+ * Name:        crypto_sign_keypool_free
+ *
+ * Description: Stops the background thread, and wipes and frees the
+ *              pooled key pairs. The pool can be set up again afterwards.
+ *
+ *              Must not be called concurrently with other calls to
+ *              crypto_sign_keypool_init or crypto_sign_keypool_free.
+ **************************************************/
+void crypto_sign_keypool_free(void);
+
+#endif /* MLD_CONFIG_KEYPOOL && !CBMC */
+#endif /* !MLD_KEYPOOL_H */
@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WARNING: This file is auto-generated from scripts/autogen
+ *          Do not modify it directly.
+ */
+
+/******************************************************************************
+ *
+ * Single compilation unit (SCU) for fixed-level build of mldsa-native
+ *
+ * This compilation unit bundles together all source files for a build
+ * of mldsa-native for a fixed parameter set (MLDSA_MODE). Compiling it
+ * instead of the individual source files allows the compiler to inline
+ * across what are otherwise separate compilation units, and, by setting
+ * MLD_CONFIG_INTERNAL_API_QUALIFIER to `static`, to expose only the
+ * public API.
+ *
+ * This file may be included more than once in a single compilation unit,
+ * for different parameter sets. In that case, all but one inclusion must
+ * set MLD_CONFIG_MULTILEVEL_NO_SHARED, and all but the last inclusion must
+ * set MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS. See
+ * test/mldsa_native_all.c for an example.
+ *
+ * Native assembly files are not included and must be compiled and
+ * linked separately; like the FIPS202 code, they are shared between
+ * all parameter sets.
+ *
+ ******************************************************************************/
+
+#include "expanded.c"
+#include "keypool.c"
+#include "packing.c"
+#include "poly_kl.c"
+#include "polyvec.c"
+#include "sign.c"
+#include "verify_cache.c"
+
+#if !defined(MLD_CONFIG_MULTILEVEL_NO_SHARED)
+#include "debug.c"
+#include "fips202/fips202.c"
+#include "fips202/fips202x4.c"
+#include "fips202/fips202x8.c"
+#include "native/aarch64/src/aarch64_zetas.c"
+#include "native/aarch64_sve2/src/aarch64_sve2_zetas.c"
+#include "native/x86_64/src/x86_64_zetas.c"
+#include "ntt.c"
+#include "poly.c"
+#include "stats.c"
+#include "symmetric-shake.c"
+#include "sys.c"
+#include "trace.c"
+#endif /* !MLD_CONFIG_MULTILEVEL_NO_SHARED */
+
+/* Macro #undef's
+ *
+ * The following undefines all macros defined in the headers of
+ * mldsa-native, so that this file can be included again for a
+ * different parameter set.
+ *
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+
+/* mldsa/common.h */
+#undef MLD_COMMON_H
+#undef MLD_NATIVE_FUNC_SUCCESS
+#undef MLD_NATIVE_FUNC_FALLBACK
+#undef MLD_CONCAT_
+#undef MLD_CONCAT
+#undef MLD_ASM_NAMESPACE
+#undef MLD_ASM_FN_SYMBOL
+#undef MLD_EMPTY_CU
+/* mldsa/config.h */
+#undef MLD_CONFIG_H
+#undef MLD_RANDOMIZED_SIGNING
+#undef MLDSA_MODE
+#undef CRYPTO_ALGNAME
+#undef MLD_NAMESPACETOP
+#undef MLD_NAMESPACE
+#undef MLD_NAMESPACE_SHARED
+#undef MLD_CONFIG_ARITH_BACKEND_FILE
+#undef MLD_CONFIG_FIPS202_BACKEND_FILE
+/* mldsa/expanded.h */
+#undef MLD_EXPANDED_H
+#undef MLD_EXPANDED_VERSION
+#undef MLD_EXPANDED_BOM
+#undef mld_expanded_header
+#undef mld_expanded_pk
+#undef mld_expanded_sk
+#undef mld_expanded_csk
+#undef mld_expanded_pk_header_ok
+#undef mld_expanded_sk_header_ok
+#undef mld_compact_sk_header_ok
+#undef crypto_sign_expand_pk
+#undef crypto_sign_expand_sk
+#undef crypto_sign_compact_sk
+#undef crypto_sign_expanded_pk_check
+#undef crypto_sign_expanded_sk_check
+#undef crypto_sign_compact_sk_check
+/* mldsa/keypool.h */
+#undef MLD_KEYPOOL_H
+#undef crypto_sign_keypool_init
+#undef crypto_sign_keypool_pop
+#undef crypto_sign_keypool_free
+/* mldsa/packing.h */
+#undef MLD_PACKING_H
+#undef pack_pk
+#undef pack_sk
+#undef unpack_pk
+#undef unpack_sk
+#undef unpack_sig
+/* mldsa/params.h */
+#undef MLD_PARAMS_H
+#undef MLDSA_SEEDBYTES
+#undef MLDSA_CRHBYTES
+#undef MLDSA_TRBYTES
+#undef MLDSA_RNDBYTES
+#undef MLDSA_N
+#undef MLDSA_Q
+#undef MLDSA_Q_HALF
+#undef MLDSA_D
+#undef MLDSA_K
+#undef MLDSA_L
+#undef MLDSA_ETA
+#undef MLDSA_TAU
+#undef MLDSA_BETA
+#undef MLDSA_GAMMA1
+#undef MLDSA_GAMMA2
+#undef MLDSA_OMEGA
+#undef MLDSA_CTILDEBYTES
+#undef MLDSA_POLYZ_PACKEDBYTES
+#undef MLDSA_POLYW1_PACKEDBYTES
+#undef MLDSA_POLYETA_PACKEDBYTES
+#undef MLDSA_POLYT1_PACKEDBYTES
+#undef MLDSA_POLYT0_PACKEDBYTES
+#undef MLDSA_POLYVECH_PACKEDBYTES
+#undef CRYPTO_PUBLICKEYBYTES
+#undef CRYPTO_SECRETKEYBYTES
+#undef CRYPTO_BYTES
+#undef CRYPTO_EXPANDED_PUBLICKEYBYTES
+#undef CRYPTO_EXPANDED_SECRETKEYBYTES
+#undef CRYPTO_COMPACT_SECRETKEYBYTES
+/* mldsa/poly_kl.h */
+#undef MLD_POLY_KL_H
+#undef poly_power2round
+#undef poly_decompose
+#undef poly_make_hint_packed
+#undef poly_use_hint
+#undef poly_uniform_eta
+#undef poly_uniform_eta_4x
+#undef poly_uniform_gamma1
+#undef poly_challenge
+#undef mld_sparse_challenge
+#undef poly_challenge_sparse
+#undef poly_sparse_mul_s8
+#undef poly_sparse_mul_s16
+#undef polyeta_pack
+#undef MLD_POLYETA_UNPACK_LOWER_BOUND
+#undef polyeta_unpack
+#undef polyz_pack
+#undef polyz_unpack
+#undef polyw1_pack
+/* mldsa/polyvec.h */
+#undef MLD_POLYVEC_H
+#undef polyvecl
+#undef polyvecl_uniform_eta
+#undef polyvecl_uniform_gamma1
+#undef polyvecl_reduce
+#undef polyvecl_add
+#undef polyvecl_ntt
+#undef polyvecl_invntt_tomont
+#undef polyvecl_pointwise_poly_montgomery
+#undef polyvecl_pointwise_acc_montgomery
+#undef polyvecl_chknorm
+#undef polyveck
+#undef polyveck_uniform_eta
+#undef polyveck_reduce
+#undef polyveck_caddq
+#undef polyveck_add
+#undef polyveck_sub
+#undef polyveck_shiftl
+#undef polyveck_ntt
+#undef polyveck_invntt_tomont
+#undef polyveck_pointwise_poly_montgomery
+#undef polyveck_chknorm
+#undef polyveck_power2round
+#undef polyveck_decompose
+#undef polyveck_use_hint
+#undef polyveck_pack_w1
+#undef polyveck_pack_eta
+#undef polyvecl_pack_eta
+#undef polyvecl_pack_z
+#undef polyveck_pack_t0
+#undef polyvecl_unpack_eta
+#undef polyvecl_unpack_z
+#undef polyveck_unpack_eta
+#undef polyveck_unpack_t0
+#undef polyvec_matrix_expand
+#undef polyvec_matrix_pointwise_montgomery
+/* mldsa/rounding.h */
+#undef MLD_ROUNDING_H
+#undef MLD_2_POW_D
+#undef power2round
+#undef decompose
+#undef make_hint
+#undef use_hint
+/* mldsa/sign.h */
+#undef MLD_SIGN_H
+#undef crypto_sign_keypair_internal
+#undef crypto_sign_keypair
+#undef crypto_sign_keypair_batch_internal
+#undef crypto_sign_keypair_batch
+#undef crypto_sign_pk_from_seed
+#undef crypto_sign_keypair_seed
+#undef crypto_sign_signature_internal
+#undef crypto_sign_signature
+#undef crypto_sign_signature_expanded_internal
+#undef crypto_sign_signature_expanded
+#undef crypto_sign_signature_compact_internal
+#undef crypto_sign_signature_compact
+#undef crypto_sign_signature_seed_internal
+#undef crypto_sign_signature_seed
+#undef crypto_sign_signature_extmu
+#undef crypto_sign
+#undef crypto_sign_inplace
+#undef crypto_sign_verify_internal
+#undef crypto_sign_verify
+#undef crypto_sign_verify_expanded_internal
+#undef crypto_sign_verify_expanded
+#undef crypto_sign_verify_extmu
+#undef crypto_sign_open
+#undef crypto_sign_open_inplace
+/* mldsa/verify_cache.h */
+#undef MLD_VERIFY_CACHE_H
+#undef MLD_VERIFY_CACHE_ENTRIES
+#undef MLD_VERIFY_CACHE_SHARDS
+#undef mld_verify_cache_lookup
+#undef mld_verify_cache_insert
+#undef crypto_sign_verify_cache_stats
+#undef crypto_sign_verify_cache_clear
+
+#if !defined(MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS)
+/* mldsa/cbmc.h */
+#undef MLD_CBMC_H
+#undef __contract__
+#undef __loop__
+#undef cassert
+#undef assigns
+#undef requires
+#undef ensures
+#undef invariant
+#undef decreases
+#undef assume
+#undef return_value
+#undef object_whole
+#undef memory_slice
+#undef same_object
+#undef memory_no_alias
+#undef readable
+#undef writeable
+#undef old
+#undef loop_entry
+#undef forall
+#undef exists
+#undef CBMC_CONCAT_
+#undef CBMC_CONCAT
+#undef array_bound_core
+#undef array_bound
+#undef array_abs_bound
+/* mldsa/debug.h */
+#undef MLD_DEBUG_H
+#undef mld_debug_check_assert
+#undef mld_debug_check_bounds
+#undef mld_assert
+#undef mld_assert_bound
+#undef mld_assert_abs_bound
+#undef mld_assert_bound_2d
+#undef mld_assert_abs_bound_2d
+/* mldsa/fips202/fips202.h */
+#undef MLD_FIPS202_FIPS202_H
+#undef FIPS202_NAMESPACE
+#undef KeccakF_RoundConstants
+#undef SHAKE128_RATE
+#undef SHAKE256_RATE
+#undef SHA3_256_RATE
+#undef SHA3_512_RATE
+#undef MLD_KECCAK_LANES
+#undef SHA3_256_HASHBYTES
+#undef SHA3_512_HASHBYTES
+#undef mld_keccakf1600_permutations
+#undef mld_keccakf1600_permute
+#undef shake128_init
+#undef shake128_absorb
+#undef shake128_finalize
+#undef shake128_squeeze
+#undef shake128_absorb_once
+#undef shake128_squeezeblocks
+#undef shake256_init
+#undef shake256_absorb
+#undef shake256_finalize
+#undef shake256_squeeze
+#undef shake256_absorb_once
+#undef shake256_squeezeblocks
+#undef shake128
+#undef shake256
+#undef sha3_256
+#undef sha3_512
+/* mldsa/fips202/fips202x4.h */
+#undef MLD_FIPS202_FIPS202X4_H
+#undef mld_shake128x4_absorb_once
+#undef mld_shake128x4_squeezeblocks
+#undef mld_shake256x4
+/* mldsa/fips202/fips202x8.h */
+#undef MLD_FIPS202_FIPS202X8_H
+#undef mld_shake128x8_absorb_once
+#undef mld_shake128x8_squeezeblocks
+/* mldsa/fips202/native/api.h */
+#undef MLD_FIPS202_NATIVE_API_H
+/* mldsa/fips202/native/meta.h */
+#undef MLD_FIPS202_NATIVE_META_H
+/* mldsa/fips202/native/x86_64/meta.h */
+#undef MLD_FIPS202_NATIVE_X86_64_META_H
+#undef MLD_USE_FIPS202_X8_NATIVE
+#undef MLD_FIPS202_BACKEND_X86_64_AVX512
+/* mldsa/fips202/native/x86_64/src/fips202_native_x86_64.h */
+#undef MLD_FIPS202_NATIVE_X86_64_SRC_FIPS202_NATIVE_X86_64_H
+#undef mld_keccak_f1600_x8_avx512_asm
+/* mldsa/native/aarch64/meta.h */
+#undef MLD_NATIVE_AARCH64_META_H
+#undef MLD_USE_NATIVE_NTT
+#undef MLD_USE_NATIVE_INTT
+#undef MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#undef MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY
+#undef MLD_USE_NATIVE_REDUCE
+#undef MLD_USE_NATIVE_CADDQ
+#undef MLD_USE_NATIVE_SHIFTL
+#undef MLD_USE_NATIVE_POWER2ROUND
+#undef MLD_USE_NATIVE_ADD
+#undef MLD_USE_NATIVE_SUB
+#undef MLD_ARITH_BACKEND_AARCH64
+/* mldsa/native/aarch64/src/arith_native_aarch64.h */
+#undef MLD_NATIVE_AARCH64_SRC_ARITH_NATIVE_AARCH64_H
+#undef mld_aarch64_ntt_zetas_layer123456
+#undef mld_aarch64_ntt_zetas_layer78
+#undef mld_aarch64_intt_zetas_layer78
+#undef mld_aarch64_intt_zetas_layer123456
+#undef mld_ntt_asm
+#undef mld_intt_asm
+#undef mld_poly_pointwise_montgomery_asm
+#undef mld_polyvecl_pointwise_acc_montgomery_asm
+#undef mld_poly_reduce_asm
+#undef mld_poly_caddq_asm
+#undef mld_poly_shiftl_asm
+#undef mld_poly_power2round_asm
+#undef mld_poly_add_asm
+#undef mld_poly_sub_asm
+/* mldsa/native/aarch64_sve2/meta.h */
+#undef MLD_NATIVE_AARCH64_SVE2_META_H
+#undef MLD_USE_NATIVE_NTT
+#undef MLD_USE_NATIVE_INTT
+#undef MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#undef MLD_USE_NATIVE_REJ_UNIFORM
+#undef MLD_ARITH_BACKEND_AARCH64_SVE2
+/* mldsa/native/aarch64_sve2/src/arith_native_aarch64_sve2.h */
+#undef MLD_NATIVE_AARCH64_SVE2_SRC_ARITH_NATIVE_AARCH64_SVE2_H
+#undef mld_aarch64_sve2_ntt_zetas
+#undef mld_aarch64_sve2_ntt_zetas_qinv
+#undef mld_aarch64_sve2_intt_zetas
+#undef mld_aarch64_sve2_intt_zetas_qinv
+#undef mld_ntt_sve2_asm
+#undef mld_intt_sve2_asm
+#undef mld_poly_pointwise_montgomery_sve2_asm
+#undef mld_rej_uniform_sve2_asm
+/* mldsa/native/api.h */
+#undef MLD_NATIVE_API_H
+/* mldsa/native/meta.h */
+#undef MLD_NATIVE_META_H
+/* mldsa/native/x86_64/meta.h */
+#undef MLD_NATIVE_X86_64_META_H
+#undef MLD_USE_NATIVE_NTT
+#undef MLD_USE_NATIVE_INTT
+#undef MLD_USE_NATIVE_POLYVEC_NTT
+#undef MLD_USE_NATIVE_POLYVEC_INTT
+#undef MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#undef MLD_ARITH_BACKEND_X86_64_AVX512
+/* mldsa/native/x86_64/src/arith_native_x86_64.h */
+#undef MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+#undef mld_x86_64_avx512_ntt_zetas
+#undef mld_x86_64_avx512_intt_zetas
+#undef mld_ntt_avx512_asm
+#undef mld_intt_avx512_asm
+#undef mld_polyvec_ntt_avx512_asm
+#undef mld_polyvec_intt_avx512_asm
+#undef mld_poly_pointwise_montgomery_avx512_asm
+/* mldsa/ntt.h */
+#undef MLD_NTT_H
+#undef MLD_NTT_BOUND
+#undef ntt
+#undef invntt_tomont
+/* mldsa/poly.h */
+#undef MLD_POLY_H
+#undef poly_reduce
+#undef poly_caddq
+#undef poly_add
+#undef poly_sub
+#undef poly_shiftl
+#undef poly_ntt
+#undef poly_invntt_tomont
+#undef poly_pointwise_montgomery
+#undef poly_chknorm
+#undef poly_uniform
+#undef poly_uniform_4x
+#undef poly_uniform_8x
+#undef polyt1_pack
+#undef polyt1_unpack
+#undef polyt0_pack
+#undef polyt0_unpack
+/* mldsa/randombytes.h */
+#undef MLD_RANDOMBYTES_H
+/* mldsa/reduce.h */
+#undef MLD_REDUCE_H
+#undef MONT
+#undef REDUCE_DOMAIN_MAX
+#undef REDUCE_RANGE_MAX
+#undef MONTGOMERY_REDUCE_DOMAIN_MAX
+#undef mld_cast_uint32_to_int32
+#undef montgomery_reduce
+#undef reduce32
+#undef caddq
+/* mldsa/stats.h */
+#undef MLD_STATS_H
+#undef MLD_THREAD_LOCAL
+#undef MLD_STATS_REJ_BUCKETS
+#undef mld_stats_get
+#undef mld_stats_reset
+#undef mld_stats_counters
+#undef MLD_STATS_INC
+#undef MLD_STATS_ADD
+#undef MLD_STATS_SIGNATURE
+/* mldsa/symmetric.h */
+#undef MLD_SYMMETRIC_H
+#undef stream128_state
+#undef stream256_state
+#undef mldsa_shake128_stream_init
+#undef mldsa_shake256_stream_init
+#undef STREAM128_BLOCKBYTES
+#undef STREAM256_BLOCKBYTES
+#undef stream128_init
+#undef stream128_squeezeblocks
+#undef stream256_init
+#undef stream256_squeezeblocks
+/* mldsa/sys.h */
+#undef MLD_SYS_H
+#undef MLD_SYS_AARCH64
+#undef MLD_SYS_AARCH64_EB
+#undef MLD_SYS_X86_64
+#undef MLD_SYS_X86_64_AVX2
+#undef MLD_SYS_WINDOWS
+#undef MLD_HAVE_INLINE_ASM
+#undef MLD_SYS_LITTLE_ENDIAN
+#undef MLD_SYS_BIG_ENDIAN
+#undef MLD_INLINE
+#undef MLD_ALWAYS_INLINE
+#undef MLD_RESTRICT
+#undef MLD_DEFAULT_ALIGN
+#undef MLD_ALIGN_UP
+#undef MLD_ALIGN
+#undef MLD_CET_ENDBR
+#undef MLD_CT_TESTING_SECRET
+#undef MLD_CT_TESTING_DECLASSIFY
+#undef MLD_MUST_CHECK_RETURN_VALUE
+#undef MLD_INTERNAL_API
+#undef mld_sys_check_capability
+/* mldsa/trace.h */
+#undef MLD_TRACE_H
+#undef mld_trace_register
+#undef mld_trace_stage_name
+#undef mld_trace_now
+#undef mld_trace_end_stage
+#undef MLD_TRACE_DECLARE
+#undef MLD_TRACE_START
+#undef MLD_TRACE_STAGE
+#endif /* !MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS */
@@ -10,6 +10,14 @@
 /* Set of primitives that this backend replaces */
 #define MLD_USE_NATIVE_NTT
 #define MLD_USE_NATIVE_INTT
+#define MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#define MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY
+#define MLD_USE_NATIVE_REDUCE
+#define MLD_USE_NATIVE_CADDQ
+#define MLD_USE_NATIVE_SHIFTL
+#define MLD_USE_NATIVE_POWER2ROUND
+#define MLD_USE_NATIVE_ADD
+#define MLD_USE_NATIVE_SUB
 
 /* Identifier for this backend so that source and assembly files
  * in the build can be appropriately guarded. */
@@ -19,16 +27,77 @@
 #if !defined(__ASSEMBLER__)
 #include "src/arith_native_aarch64.h"
 
-static MLD_INLINE void mld_ntt_native(int32_t data[MLDSA_N])
+/* Neon is part of the AArch64 base architecture, so no capability
+ * check is needed. */
+static MLD_INLINE int mld_ntt_native(int32_t data[MLDSA_N])
 {
   mld_ntt_asm(data, mld_aarch64_ntt_zetas_layer123456,
               mld_aarch64_ntt_zetas_layer78);
+  return MLD_NATIVE_FUNC_SUCCESS;
 }
 
-static MLD_INLINE void mld_intt_native(int32_t data[MLDSA_N])
+static MLD_INLINE int mld_intt_native(int32_t data[MLDSA_N])
 {
   mld_intt_asm(data, mld_aarch64_intt_zetas_layer78,
                mld_aarch64_intt_zetas_layer123456);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_pointwise_montgomery_native(
+    int32_t c[MLDSA_N], const int32_t a[MLDSA_N], const int32_t b[MLDSA_N])
+{
+  mld_poly_pointwise_montgomery_asm(c, a, b);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_polyvecl_pointwise_acc_montgomery_native(
+    int32_t w[MLDSA_N], const int32_t u[MLDSA_L * MLDSA_N],
+    const int32_t v[MLDSA_L * MLDSA_N])
+{
+  mld_polyvecl_pointwise_acc_montgomery_asm(w, u, v, MLDSA_L);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_reduce_native(int32_t a[MLDSA_N])
+{
+  mld_poly_reduce_asm(a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_caddq_native(int32_t a[MLDSA_N])
+{
+  mld_poly_caddq_asm(a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_shiftl_native(int32_t a[MLDSA_N])
+{
+  mld_poly_shiftl_asm(a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_power2round_native(int32_t a1[MLDSA_N],
+                                                  int32_t a0[MLDSA_N],
+                                                  const int32_t a[MLDSA_N])
+{
+  mld_poly_power2round_asm(a1, a0, a);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_add_native(int32_t c[MLDSA_N],
+                                          const int32_t a[MLDSA_N],
+                                          const int32_t b[MLDSA_N])
+{
+  mld_poly_add_asm(c, a, b);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_sub_native(int32_t c[MLDSA_N],
+                                          const int32_t a[MLDSA_N],
+                                          const int32_t b[MLDSA_N])
+{
+  mld_poly_sub_asm(c, a, b);
+  return MLD_NATIVE_FUNC_SUCCESS;
 }
 
 #endif /* !__ASSEMBLER__ */
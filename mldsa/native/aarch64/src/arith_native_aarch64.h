@@ -11,14 +11,14 @@
 #include "../../../common.h"
 
 #define mld_aarch64_ntt_zetas_layer123456 \
-  MLD_NAMESPACE(mld_aarch64_ntt_zetas_layer123456)
+  MLD_NAMESPACE_SHARED(aarch64_ntt_zetas_layer123456)
 #define mld_aarch64_ntt_zetas_layer78 \
-  MLD_NAMESPACE(mld_aarch64_ntt_zetas_layer78)
+  MLD_NAMESPACE_SHARED(aarch64_ntt_zetas_layer78)
 
 #define mld_aarch64_intt_zetas_layer78 \
-  MLD_NAMESPACE(mld_aarch64_intt_zetas_layer78)
+  MLD_NAMESPACE_SHARED(aarch64_intt_zetas_layer78)
 #define mld_aarch64_intt_zetas_layer123456 \
-  MLD_NAMESPACE(mld_aarch64_intt_zetas_layer123456)
+  MLD_NAMESPACE_SHARED(aarch64_intt_zetas_layer123456)
 
 extern const int32_t mld_aarch64_ntt_zetas_layer123456[];
 extern const int32_t mld_aarch64_ntt_zetas_layer78[];
@@ -26,10 +26,38 @@ extern const int32_t mld_aarch64_ntt_zetas_layer78[];
 extern const int32_t mld_aarch64_intt_zetas_layer78[];
 extern const int32_t mld_aarch64_intt_zetas_layer123456[];
 
-#define mld_ntt_asm MLD_NAMESPACE(ntt_asm)
+#define mld_ntt_asm MLD_NAMESPACE_SHARED(ntt_asm)
 void mld_ntt_asm(int32_t *, const int32_t *, const int32_t *);
 
-#define mld_intt_asm MLD_NAMESPACE(intt_asm)
+#define mld_intt_asm MLD_NAMESPACE_SHARED(intt_asm)
 void mld_intt_asm(int32_t *, const int32_t *, const int32_t *);
 
+#define mld_poly_pointwise_montgomery_asm \
+  MLD_NAMESPACE_SHARED(poly_pointwise_montgomery_asm)
+void mld_poly_pointwise_montgomery_asm(int32_t *, const int32_t *,
+                                       const int32_t *);
+
+#define mld_polyvecl_pointwise_acc_montgomery_asm \
+  MLD_NAMESPACE_SHARED(polyvecl_pointwise_acc_montgomery_asm)
+void mld_polyvecl_pointwise_acc_montgomery_asm(int32_t *, const int32_t *,
+                                               const int32_t *, uint64_t);
+
+#define mld_poly_reduce_asm MLD_NAMESPACE_SHARED(poly_reduce_asm)
+void mld_poly_reduce_asm(int32_t *);
+
+#define mld_poly_caddq_asm MLD_NAMESPACE_SHARED(poly_caddq_asm)
+void mld_poly_caddq_asm(int32_t *);
+
+#define mld_poly_shiftl_asm MLD_NAMESPACE_SHARED(poly_shiftl_asm)
+void mld_poly_shiftl_asm(int32_t *);
+
+#define mld_poly_power2round_asm MLD_NAMESPACE_SHARED(poly_power2round_asm)
+void mld_poly_power2round_asm(int32_t *, int32_t *, const int32_t *);
+
+#define mld_poly_add_asm MLD_NAMESPACE_SHARED(poly_add_asm)
+void mld_poly_add_asm(int32_t *, const int32_t *, const int32_t *);
+
+#define mld_poly_sub_asm MLD_NAMESPACE_SHARED(poly_sub_asm)
+void mld_poly_sub_asm(int32_t *, const int32_t *, const int32_t *);
+
 #endif /* !MLD_NATIVE_AARCH64_SRC_ARITH_NATIVE_AARCH64_H */
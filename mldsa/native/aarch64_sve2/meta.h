@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_NATIVE_AARCH64_SVE2_META_H
+#define MLD_NATIVE_AARCH64_SVE2_META_H
+
+/*
+ * Vector-length agnostic SVE2 backend. It is not selected by default;
+ * use it by setting MLD_CONFIG_ARITH_BACKEND_FILE to
+ * "native/aarch64_sve2/meta.h".
+ */
+
+/* Set of primitives that this backend replaces */
+#define MLD_USE_NATIVE_NTT
+#define MLD_USE_NATIVE_INTT
+#define MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+#define MLD_USE_NATIVE_REJ_UNIFORM
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLD_ARITH_BACKEND_AARCH64_SVE2
+
+
+#if !defined(__ASSEMBLER__)
+#include "src/arith_native_aarch64_sve2.h"
+
+/* SVE2 is optional, so all functions fall back to the C code on hosts
+ * without it. */
+static MLD_INLINE int mld_ntt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_SVE2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_ntt_sve2_asm(data, mld_aarch64_sve2_ntt_zetas,
+                   mld_aarch64_sve2_ntt_zetas_qinv);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_intt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_SVE2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_intt_sve2_asm(data, mld_aarch64_sve2_intt_zetas,
+                    mld_aarch64_sve2_intt_zetas_qinv);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_pointwise_montgomery_native(
+    int32_t c[MLDSA_N], const int32_t a[MLDSA_N], const int32_t b[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_SVE2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_poly_pointwise_montgomery_sve2_asm(c, a, b);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_rej_uniform_native(int32_t *r, unsigned len,
+                                             const uint8_t *buf,
+                                             unsigned buflen)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_SVE2))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  return (int)mld_rej_uniform_sve2_asm(r, len, buf, buflen);
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_NATIVE_AARCH64_SVE2_META_H */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_NATIVE_AARCH64_SVE2_SRC_ARITH_NATIVE_AARCH64_SVE2_H
+#define MLD_NATIVE_AARCH64_SVE2_SRC_ARITH_NATIVE_AARCH64_SVE2_H
+
+#include <stdint.h>
+#include "../../../common.h"
+
+#define mld_aarch64_sve2_ntt_zetas MLD_NAMESPACE_SHARED(aarch64_sve2_ntt_zetas)
+#define mld_aarch64_sve2_ntt_zetas_qinv \
+  MLD_NAMESPACE_SHARED(aarch64_sve2_ntt_zetas_qinv)
+#define mld_aarch64_sve2_intt_zetas \
+  MLD_NAMESPACE_SHARED(aarch64_sve2_intt_zetas)
+#define mld_aarch64_sve2_intt_zetas_qinv \
+  MLD_NAMESPACE_SHARED(aarch64_sve2_intt_zetas_qinv)
+
+extern const int32_t mld_aarch64_sve2_ntt_zetas[];
+extern const int32_t mld_aarch64_sve2_ntt_zetas_qinv[];
+
+extern const int32_t mld_aarch64_sve2_intt_zetas[];
+extern const int32_t mld_aarch64_sve2_intt_zetas_qinv[];
+
+#define mld_ntt_sve2_asm MLD_NAMESPACE_SHARED(ntt_sve2_asm)
+void mld_ntt_sve2_asm(int32_t *, const int32_t *, const int32_t *);
+
+#define mld_intt_sve2_asm MLD_NAMESPACE_SHARED(intt_sve2_asm)
+void mld_intt_sve2_asm(int32_t *, const int32_t *, const int32_t *);
+
+#define mld_poly_pointwise_montgomery_sve2_asm \
+  MLD_NAMESPACE_SHARED(poly_pointwise_montgomery_sve2_asm)
+void mld_poly_pointwise_montgomery_sve2_asm(int32_t *, const int32_t *,
+                                            const int32_t *);
+
+#define mld_rej_uniform_sve2_asm MLD_NAMESPACE_SHARED(rej_uniform_sve2_asm)
+uint64_t mld_rej_uniform_sve2_asm(int32_t *, unsigned, const uint8_t *,
+                                  unsigned);
+
+#endif /* !MLD_NATIVE_AARCH64_SVE2_SRC_ARITH_NATIVE_AARCH64_SVE2_H */
@@ -31,6 +31,12 @@
  * To add a function to a backend, define MLD_USE_NATIVE_XXX and
  * implement `static inline xxx(...)` in the profile header.
  *
+ * Native functions return MLD_NATIVE_FUNC_SUCCESS or, if they cannot
+ * handle the call, MLD_NATIVE_FUNC_FALLBACK, in which case the C code is
+ * used instead. Backends relying on optional instruction set extensions
+ * use this to dispatch at runtime, by checking
+ * mld_sys_check_capability() (see sys.h) before using them.
+ *
  */
 
 /*
@@ -51,8 +57,11 @@
  *              The output polynomial is in bitreversed order.
  *
  * Arguments:   - int32_t p[MLDSA_N]: pointer to in/output polynomial
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, p must be left unmodified.
  **************************************************/
-static MLD_INLINE void mld_ntt_native(int32_t p[MLDSA_N]);
+static MLD_INLINE int mld_ntt_native(int32_t p[MLDSA_N]);
 #endif /* MLD_USE_NATIVE_NTT */
 
 
@@ -66,9 +75,275 @@ static MLD_INLINE void mld_ntt_native(int32_t p[MLDSA_N]);
  *              The input polynomial is in bitreversed order.
  *              The output polynomial is assumed to be in normal order.
  *
- * Arguments:   - uint32_t p[MLDSA_N]: pointer to in/output polynomial
+ * Arguments:   - int32_t p[MLDSA_N]: pointer to in/output polynomial
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, p must be left unmodified.
  **************************************************/
-static MLD_INLINE void mld_intt_native(int16_t p[MLKEM_N])
+static MLD_INLINE int mld_intt_native(int32_t p[MLDSA_N]);
 #endif /* MLD_USE_NATIVE_INTT */
 
+#if defined(MLD_USE_NATIVE_POLYVEC_NTT)
+/*************************************************
+ * Name:        mld_polyvec_ntt_native
+ *
+ * Description: Computes the NTT of n consecutive polynomials in place,
+ *              with the same result as n calls to mld_ntt_native().
+ *
+ *              This allows a backend to transform a whole vector of
+ *              polynomials in one call, sharing the dispatch and the
+ *              setup of its constants, or to process several
+ *              polynomials per pass. The output must be in the same
+ *              layout as the input.
+ *
+ *              n is MLDSA_L or MLDSA_K, so at most 8.
+ *
+ * Arguments:   - int32_t *p: pointer to n * MLDSA_N in/output coefficients
+ *              - unsigned n: number of polynomials
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, p must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_polyvec_ntt_native(int32_t *p, unsigned n);
+#endif /* MLD_USE_NATIVE_POLYVEC_NTT */
+
+#if defined(MLD_USE_NATIVE_POLYVEC_INTT)
+/*************************************************
+ * Name:        mld_polyvec_intt_native
+ *
+ * Description: Computes the inverse NTT of n consecutive polynomials in
+ *              place, with the same result as n calls to
+ *              mld_intt_native(). See mld_polyvec_ntt_native().
+ *
+ * Arguments:   - int32_t *p: pointer to n * MLDSA_N in/output coefficients
+ *              - unsigned n: number of polynomials
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, p must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_polyvec_intt_native(int32_t *p, unsigned n);
+#endif /* MLD_USE_NATIVE_POLYVEC_INTT */
+
+#if defined(MLD_USE_NATIVE_POINTWISE_MONTGOMERY)
+/*************************************************
+ * Name:        mld_poly_pointwise_montgomery_native
+ *
+ * Description: Pointwise multiplication of polynomials in NTT domain
+ *              with Montgomery reduction, c[i] = a[i] * b[i] * 2^{-32}.
+ *
+ *              Semantically equivalent to poly_pointwise_montgomery()
+ *              in poly.c: the output must be the same representative
+ *              as montgomery_reduce() computes, so that the result
+ *              does not depend on the backend.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t a[MLDSA_N]: first input polynomial
+ *              - const int32_t b[MLDSA_N]: second input polynomial
+ *
+ * The input coefficients may be any int32_t other than INT32_MIN.
+ * c may be equal to a or b.
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, c must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_pointwise_montgomery_native(
+    int32_t c[MLDSA_N], const int32_t a[MLDSA_N], const int32_t b[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POINTWISE_MONTGOMERY */
+
+#if defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY)
+/*************************************************
+ * Name:        mld_polyvecl_pointwise_acc_montgomery_native
+ *
+ * Description: Pointwise multiplication of vectors of MLDSA_L
+ *              polynomials in NTT domain, with Montgomery reduction of
+ *              each product, followed by the sum of the products.
+ *
+ *              Semantically equivalent to
+ *              polyvecl_pointwise_acc_montgomery() in polyvec.c, and
+ *              with the same output representative: each product is
+ *              reduced as by montgomery_reduce() before the sum.
+ *
+ * Arguments:   - int32_t w[MLDSA_N]: output polynomial
+ *              - const int32_t u[MLDSA_L * MLDSA_N]: first input vector
+ *              - const int32_t v[MLDSA_L * MLDSA_N]: second input vector
+ *
+ * The input coefficients may be any int32_t other than INT32_MIN.
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, w must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_polyvecl_pointwise_acc_montgomery_native(
+    int32_t w[MLDSA_N], const int32_t u[MLDSA_L * MLDSA_N],
+    const int32_t v[MLDSA_L * MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY */
+
+#if defined(MLD_USE_NATIVE_REDUCE)
+/*************************************************
+ * Name:        mld_poly_reduce_native
+ *
+ * Description: Reduces all coefficients of a polynomial in place, as
+ *              reduce32() in reduce.h, to -REDUCE_RANGE_MAX <= r <
+ *              REDUCE_RANGE_MAX.
+ *
+ *              Semantically equivalent to poly_reduce() in poly.c.
+ *
+ * Arguments:   - int32_t a[MLDSA_N]: in/output polynomial, with
+ *                coefficients at most REDUCE_DOMAIN_MAX
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, a must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_reduce_native(int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_REDUCE */
+
+#if defined(MLD_USE_NATIVE_CADDQ)
+/*************************************************
+ * Name:        mld_poly_caddq_native
+ *
+ * Description: Adds MLDSA_Q to all negative coefficients of a
+ *              polynomial in place.
+ *
+ *              Semantically equivalent to poly_caddq() in poly.c.
+ *
+ * Arguments:   - int32_t a[MLDSA_N]: in/output polynomial, with
+ *                coefficients bounded by MLDSA_Q in absolute value
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, a must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_caddq_native(int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_CADDQ */
+
+#if defined(MLD_USE_NATIVE_SHIFTL)
+/*************************************************
+ * Name:        mld_poly_shiftl_native
+ *
+ * Description: Multiplies all coefficients of a polynomial by 2^MLDSA_D
+ *              in place.
+ *
+ *              Semantically equivalent to poly_shiftl() in poly.c.
+ *
+ * Arguments:   - int32_t a[MLDSA_N]: in/output polynomial, with
+ *                coefficients bounded by 2^{31-MLDSA_D} in absolute value
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, a must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_shiftl_native(int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_SHIFTL */
+
+#if defined(MLD_USE_NATIVE_POWER2ROUND)
+/*************************************************
+ * Name:        mld_poly_power2round_native
+ *
+ * Description: Splits all coefficients of a polynomial as
+ *              power2round() in rounding.h.
+ *
+ *              Semantically equivalent to poly_power2round() in
+ *              poly_kl.c.
+ *
+ * Arguments:   - int32_t a1[MLDSA_N]: output polynomial of high bits
+ *              - int32_t a0[MLDSA_N]: output polynomial of low bits
+ *              - const int32_t a[MLDSA_N]: input polynomial, with
+ *                coefficients in [0, MLDSA_Q)
+ *
+ * The three polynomials do not overlap.
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, a1 and a0 must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_power2round_native(int32_t a1[MLDSA_N],
+                                                  int32_t a0[MLDSA_N],
+                                                  const int32_t a[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_POWER2ROUND */
+
+#if defined(MLD_USE_NATIVE_ADD)
+/*************************************************
+ * Name:        mld_poly_add_native
+ *
+ * Description: Adds two polynomials, without modular reduction.
+ *
+ *              Semantically equivalent to poly_add() in poly.c.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t a[MLDSA_N]: first summand
+ *              - const int32_t b[MLDSA_N]: second summand
+ *
+ * c may be equal to a or b.
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, c must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_add_native(int32_t c[MLDSA_N],
+                                          const int32_t a[MLDSA_N],
+                                          const int32_t b[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_ADD */
+
+#if defined(MLD_USE_NATIVE_SUB)
+/*************************************************
+ * Name:        mld_poly_sub_native
+ *
+ * Description: Subtracts two polynomials, without modular reduction.
+ *
+ *              Semantically equivalent to poly_sub() in poly.c.
+ *
+ * Arguments:   - int32_t c[MLDSA_N]: output polynomial
+ *              - const int32_t a[MLDSA_N]: minuend
+ *              - const int32_t b[MLDSA_N]: subtrahend
+ *
+ * c may be equal to a or b.
+ *
+ * Returns MLD_NATIVE_FUNC_SUCCESS or MLD_NATIVE_FUNC_FALLBACK. In the
+ * latter case, c must be left unmodified.
+ **************************************************/
+static MLD_INLINE int mld_poly_sub_native(int32_t c[MLDSA_N],
+                                          const int32_t a[MLDSA_N],
+                                          const int32_t b[MLDSA_N]);
+#endif /* MLD_USE_NATIVE_SUB */
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+/*************************************************
+ * Name:        mld_rej_uniform_native
+ *
+ * Description: Run rejection sampling on uniform random bytes to generate
+ *              uniform random integers in [0, MLDSA_Q-1].
+ *
+ *              Semantically equivalent to rej_uniform() in poly.c with
+ *              offset 0.
+ *
+ * Arguments:   - int32_t *r: pointer to output buffer
+ *              - unsigned len: requested number of coefficients to sample
+ *              - const uint8_t *buf: array of random bytes to sample from
+ *              - unsigned buflen: length of array of random bytes (must be
+ *                a multiple of 3)
+ *
+ * Returns the number of sampled coefficients, or MLD_NATIVE_FUNC_FALLBACK.
+ **************************************************/
+static MLD_INLINE int mld_rej_uniform_native(int32_t *r, unsigned len,
+                                             const uint8_t *buf,
+                                             unsigned buflen);
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM_ETA)
+/*************************************************
+ * Name:        mld_rej_uniform_eta_native
+ *
+ * Description: Run rejection sampling on uniform random bytes to generate
+ *              uniform random integers in [-MLDSA_ETA, MLDSA_ETA].
+ *
+ *              Semantically equivalent to rej_eta() in poly.c with
+ *              offset 0.
+ *
+ * Arguments:   - int32_t *r: pointer to output buffer
+ *              - unsigned len: requested number of coefficients to sample
+ *              - const uint8_t *buf: array of random bytes to sample from
+ *              - unsigned buflen: length of array of random bytes
+ *
+ * Returns the number of sampled coefficients, or MLD_NATIVE_FUNC_FALLBACK.
+ **************************************************/
+static MLD_INLINE int mld_rej_uniform_eta_native(int32_t *r, unsigned len,
+                                                 const uint8_t *buf,
+                                                 unsigned buflen);
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM_ETA */
+
 #endif /* !MLD_NATIVE_API_H */
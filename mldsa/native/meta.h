@@ -16,4 +16,9 @@
 #include "aarch64/meta.h"
 #endif
 
+/* The x86_64 backend uses the System V calling convention */
+#if defined(MLD_SYS_X86_64) && !defined(MLD_SYS_WINDOWS)
+#include "x86_64/meta.h"
+#endif
+
 #endif /* !MLD_NATIVE_META_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_NATIVE_X86_64_META_H
+#define MLD_NATIVE_X86_64_META_H
+
+/* Set of primitives that this backend replaces */
+#define MLD_USE_NATIVE_NTT
+#define MLD_USE_NATIVE_INTT
+#define MLD_USE_NATIVE_POLYVEC_NTT
+#define MLD_USE_NATIVE_POLYVEC_INTT
+#define MLD_USE_NATIVE_POINTWISE_MONTGOMERY
+
+/* Identifier for this backend so that source and assembly files
+ * in the build can be appropriately guarded. */
+#define MLD_ARITH_BACKEND_X86_64_AVX512
+
+#if !defined(__ASSEMBLER__)
+#include "src/arith_native_x86_64.h"
+
+/* AVX-512 is optional, so all functions fall back to the C code on hosts
+ * without it. */
+static MLD_INLINE int mld_ntt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX512))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_ntt_avx512_asm(data, mld_x86_64_avx512_ntt_zetas);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_intt_native(int32_t data[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX512))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_intt_avx512_asm(data, mld_x86_64_avx512_intt_zetas);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_polyvec_ntt_native(int32_t *p, unsigned n)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX512))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyvec_ntt_avx512_asm(p, mld_x86_64_avx512_ntt_zetas, n);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_polyvec_intt_native(int32_t *p, unsigned n)
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX512))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_polyvec_intt_avx512_asm(p, mld_x86_64_avx512_intt_zetas, n);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+static MLD_INLINE int mld_poly_pointwise_montgomery_native(
+    int32_t c[MLDSA_N], const int32_t a[MLDSA_N], const int32_t b[MLDSA_N])
+{
+  if (!mld_sys_check_capability(MLD_SYS_CAP_AVX512))
+  {
+    return MLD_NATIVE_FUNC_FALLBACK;
+  }
+  mld_poly_pointwise_montgomery_avx512_asm(c, a, b);
+  return MLD_NATIVE_FUNC_SUCCESS;
+}
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* !MLD_NATIVE_X86_64_META_H */
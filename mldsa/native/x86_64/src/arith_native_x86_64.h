@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+#define MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H
+
+#include <stdint.h>
+#include "../../../common.h"
+
+#define mld_x86_64_avx512_ntt_zetas \
+  MLD_NAMESPACE_SHARED(x86_64_avx512_ntt_zetas)
+#define mld_x86_64_avx512_intt_zetas \
+  MLD_NAMESPACE_SHARED(x86_64_avx512_intt_zetas)
+
+extern const int32_t mld_x86_64_avx512_ntt_zetas[];
+extern const int32_t mld_x86_64_avx512_intt_zetas[];
+
+#define mld_ntt_avx512_asm MLD_NAMESPACE_SHARED(ntt_avx512_asm)
+void mld_ntt_avx512_asm(int32_t *, const int32_t *);
+
+#define mld_intt_avx512_asm MLD_NAMESPACE_SHARED(intt_avx512_asm)
+void mld_intt_avx512_asm(int32_t *, const int32_t *);
+
+#define mld_polyvec_ntt_avx512_asm \
+  MLD_NAMESPACE_SHARED(polyvec_ntt_avx512_asm)
+void mld_polyvec_ntt_avx512_asm(int32_t *, const int32_t *, unsigned);
+
+#define mld_polyvec_intt_avx512_asm \
+  MLD_NAMESPACE_SHARED(polyvec_intt_avx512_asm)
+void mld_polyvec_intt_avx512_asm(int32_t *, const int32_t *, unsigned);
+
+#define mld_poly_pointwise_montgomery_avx512_asm \
+  MLD_NAMESPACE_SHARED(poly_pointwise_montgomery_avx512_asm)
+void mld_poly_pointwise_montgomery_avx512_asm(int32_t *, const int32_t *,
+                                              const int32_t *);
+
+#endif /* !MLD_NATIVE_X86_64_SRC_ARITH_NATIVE_X86_64_H */
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * WARNING: This file is auto-generated from scripts/autogen
+ *          Do not modify it directly.
+ */
+
+#include "../../../common.h"
+
+#if defined(MLD_ARITH_BACKEND_X86_64_AVX512)
+
+#include <stdint.h>
+#include "arith_native_x86_64.h"
+
+/*
+ * Tables of zeta values used in the AVX-512 NTT and inverse NTT
+ * See autogen for details.
+ */
+MLD_ALIGN const int32_t mld_x86_64_avx512_ntt_zetas[] = {
+    0,           25847,       -2608894,    -518909,     237124,
+    -777960,     -876248,     466468,      1826347,     2353451,
+    -359251,     -2091905,    3119733,     -2884855,    3111497,
+    2680103,     0,           1830765815,  -1929875198, -1927777021,
+    1640767044,  1477910808,  1612161320,  1640734244,  308362795,
+    -1815525077, -1374673747, -1091570561, -1929495947, 515185417,
+    -285697463,  625853735,   2725464,     1024112,     -1079900,
+    3585928,     -549488,     -1119584,    2619752,     -2108549,
+    -2118186,    -3859737,    -1399561,    -3277672,    1757237,
+    -19422,      4010497,     280005,      1727305304,  2082316400,
+    -1364982364, 858240904,   1806278032,  222489248,   -346752664,
+    684667771,   1654287830,  -878576921,  -1257667337, -748618600,
+    329347125,   1837364258,  -1443016191, -1170414139, 2706023,
+    3077325,     -1661693,    -2537516,    -3861115,    3574422,
+    3539968,     2348700,     -1699267,    3505694,     3507263,
+    -1600420,    811944,      954230,      3900724,     2071892,
+    -1846138265, -1404529459, 1594295555,  -1898723372, -202001019,
+    -561427818,  -1061813248, -1661512036, -1750224323, 418987550,
+    -1925356481, 879957084,   1484874664,  -285388938,  -1495136972,
+    -1714807468, 95776,       3530437,     -3592148,    3915439,
+    -3043716,    -2867647,    -300467,     -539299,     -1643818,
+    -3821735,    -2140649,    3699596,     531354,      3881043,
+    -2556880,    -2797779,    -1631226336, 1838055109,  -1076973524,
+    -594436433,  -475984260,  1797021249,  2059733581,  -1104976547,
+    -901666090,  1831915353,  992097815,   2024403852,  -1636082790,
+    -1983539117, -950076368,  -952438995,  -3930395,    -1452451,
+    -1257611,    -3190144,    3412210,     -2967645,    -671102,
+    -381987,     -3343383,    44288,       -3724342,    2389356,
+    189548,      -2409325,    1285669,     -3019102,    -1574918427,
+    -2143979939, -1285853323, -1440787840, -783134478,  289871779,
+    2135294594,  -889861155,  1321868265,  -1784632064, 675310538,
+    -1999506068, -695180180,  1777179795,  -178766299,  1957047970,
+    -1528703,    3475950,     1939314,     -3157330,    -983419,
+    -3693493,    -1228525,    1349076,     264944,      -1100098,
+    -8578,       -210977,     -3553272,    -177440,     -1584928,
+    -3881060,    -654783359,  1651689966,  -1039411342, 1529189038,
+    -247357819,  -86965173,   1787797779,  -120646188,  -916321552,
+    2143745726,  -1261461890, 628664287,   1422575624,  -1185330464,
+    168022240,   985155484,   -3677745,    2176455,     -4083598,
+    -3632928,    2147896,     -411027,     -22981,      1852771,
+    508951,      904516,      1653064,     759969,      3159746,
+    1315589,     -812732,     -3628969,    1350681039,  1599739335,
+    -993005454,  568627424,   -588790216,  -1262003603, -1018755525,
+    1665705315,  1225434135,  666258756,   -1555941048, -1499481951,
+    -1375177022, 334803717,   -518252220,  1146323031,  -3041255,
+    -1585221,    -1000202,    126922,      2715295,     -2477047,
+    -1308169,    -1430430,    3097992,     3958618,     -3249728,
+    -1316856,    -1851402,    1341330,     -1439742,    3839961,
+    -1974159335, 140455867,   1955560694,  -2131021878, 1518161567,
+    1708872713,  1638590967,  -1669960606, 1155548552,  1210558298,
+    -318346816,  -1729304568, 1424130038,  235321234,   1206536194,
+    -894060583,  2091667,     266997,      900702,      -655327,
+    342297,      2842341,     -3767016,    -1333058,    -1279661,
+    -542412,     -2013608,    -3183426,    -3038916,    -426683,
+    -2939036,    -554416,     -898413,     -605900043,  14253662,
+    863641633,   2124962073,  -1920467227, -1536588520, 235104446,
+    831969619,   756955444,   1554794072,  -2040058690, -2047270596,
+    -1591599803, 1119856484,  155290192,   3407706,     2434439,
+    1859098,     -3122442,    286988,      2691481,     1250494,
+    1237275,     1917081,     -2831860,    2432395,     162844,
+    3523897,     1723600,     -2235985,    3919660,     991903578,
+    -44694137,   -421552614,  1747917558,  908452108,   -1176751719,
+    -72690498,   985022747,   -1078959975, -1021949428, 173440395,
+    -1316619236, 6087993,     565464272,   -1600929361, -1809756372,
+    2316500,     -1235728,    909542,      2031748,     -2437823,
+    -2590150,    2635921,     -3318210,    -2546312,    -1671176,
+    2454455,     1616392,     3866901,     -1803090,    -420899,
+    -48306,      1363007700,  -326425360,  -517299994,  -1372618620,
+    -1123881663, -635454918,  45766801,    -2070602178, 1216882040,
+    -1276805128, -1357098057, 827959816,   702390549,   -260424530,
+    -1208667171, 2036925262,  3817976,     3513181,     819034,
+    3207046,     4108315,     1265009,     -3548272,    -1430225,
+    -1374803,    -1846953,    -164721,     3014001,     269760,
+    1910376,     -2286327,    -1362209,    746144248,   2032221021,
+    1257750362,  1931587462,  885133339,   1967222129,  -1287922800,
+    1779436847,  1042326957,  713994583,   -1542497137, -883155599,
+    -1547952704, 283780712,   1123958025,  1934038751,  -3342478,
+    -3520352,    495491,      -3556995,    3437287,     4055324,
+    -2994039,    -451100,     1500165,     -2584293,    1957272,
+    810149,      2213111,     -1667432,    183443,      3937738,
+    -1363460238, 2027833504,  1014493059,  1819892093,  -1223601433,
+    -1637785316, 694382729,   -1045062172, -300448763,  -260312805,
+    1339088280,  -853476187,  -1723816713, -440824168,  1544891539,
+    -973777462,  2244091,     -3759364,    -1613174,    -525098,
+    -3342277,    1247620,     1869119,     1312455,     777191,
+    -3724270,    3369112,     1652634,     -975884,     -1104333,
+    -976891,     1400424,     912367099,   1176904444,  -818371958,
+    -325927722,  1851023419,  -1354528380, -314284737,  963438279,
+    604552167,   608791570,   -2126092136, -1039370342, -110126092,
+    -1758099917, 879867909,   400711272,   -2446433,    -1197226,
+    -43260,      -768622,     1735879,     2486353,     1903435,
+    3306115,     2235880,     594136,      185531,      -3694233,
+    1717735,     -260646,     1612842,     -846154,     30313375,
+    1683520342,  2027935492,  128353682,   137583815,   -642772911,
+    671509323,   419615363,   -270590488,  371462360,   -384158533,
+    -596344473,  -279505433,  -71875110,   -1499603926, -540420426,
+    -3562462,    -3193378,    -522500,     -3595838,    203044,
+    1595974,     -1050970,    -1962642,    3406031,     -3776993,
+    -1207385,    -1799107,    472078,      -3833893,    -3545687,
+    1976782,     -1420958686, 1904936414,  1926727420,  1258381762,
+    1629985060,  6363718,     1136965286,  1116720494,  1405999311,
+    940195359,   2061661095,  1726753853,  394851342,   776003547,
+    201262505,   374860238,
+};
+
+MLD_ALIGN const int32_t mld_x86_64_avx512_intt_zetas[] = {
+    41978,       -25847,      518909,      2608894,     -466468,
+    876248,      777960,      -237124,     -2680103,    -3111497,
+    2884855,     -3119733,    2091905,     359251,      -2353451,
+    -1826347,    -8395782,    -1830765815, 1927777021,  1929875198,
+    -1640734244, -1612161320, -1477910808, -1640767044, -625853735,
+    285697463,   -515185417,  1929495947,  1091570561,  1374673747,
+    1815525077,  -308362795,  -280005,     -4010497,    19422,
+    -1757237,    3277672,     1399561,     3859737,     2118186,
+    2108549,     -2619752,    1119584,     549488,      -3585928,
+    1079900,     -1024112,    -2725464,    1170414139,  1443016191,
+    -1837364258, -329347125,  748618600,   1257667337,  878576921,
+    -1654287830, -684667771,  346752664,   -222489248,  -1806278032,
+    -858240904,  1364982364,  -2082316400, -1727305304, 2797779,
+    2556880,     -3881043,    -531354,     -3699596,    2140649,
+    3821735,     1643818,     539299,      300467,      2867647,
+    3043716,     -3915439,    3592148,     -3530437,    -95776,
+    952438995,   950076368,   1983539117,  1636082790,  -2024403852,
+    -992097815,  -1831915353, 901666090,   1104976547,  -2059733581,
+    -1797021249, 475984260,   594436433,   1076973524,  -1838055109,
+    1631226336,  -2071892,    -3900724,    -954230,     -811944,
+    1600420,     -3507263,    -3505694,    1699267,     -2348700,
+    -3539968,    -3574422,    3861115,     2537516,     1661693,
+    -3077325,    -2706023,    1714807468,  1495136972,  285388938,
+    -1484874664, -879957084,  1925356481,  -418987550,  1750224323,
+    1661512036,  1061813248,  561427818,   202001019,   1898723372,
+    -1594295555, 1404529459,  1846138265,  -3839961,    1439742,
+    -1341330,    1851402,     1316856,     3249728,     -3958618,
+    -3097992,    1430430,     1308169,     2477047,     -2715295,
+    -126922,     1000202,     1585221,     3041255,     894060583,
+    -1206536194, -235321234,  -1424130038, 1729304568,  318346816,
+    -1210558298, -1155548552, 1669960606,  -1638590967, -1708872713,
+    -1518161567, 2131021878,  -1955560694, -140455867,  1974159335,
+    3628969,     812732,      -1315589,    -3159746,    -759969,
+    -1653064,    -904516,     -508951,     -1852771,    22981,
+    411027,      -2147896,    3632928,     4083598,     -2176455,
+    3677745,     -1146323031, 518252220,   -334803717,  1375177022,
+    1499481951,  1555941048,  -666258756,  -1225434135, -1665705315,
+    1018755525,  1262003603,  588790216,   -568627424,  993005454,
+    -1599739335, -1350681039, 3881060,     1584928,     177440,
+    3553272,     210977,      8578,        1100098,     -264944,
+    -1349076,    1228525,     3693493,     983419,      3157330,
+    -1939314,    -3475950,    1528703,     -985155484,  -168022240,
+    1185330464,  -1422575624, -628664287,  1261461890,  -2143745726,
+    916321552,   120646188,   -1787797779, 86965173,    247357819,
+    -1529189038, 1039411342,  -1651689966, 654783359,   3019102,
+    -1285669,    2409325,     -189548,     -2389356,    3724342,
+    -44288,      3343383,     381987,      671102,      2967645,
+    -3412210,    3190144,     1257611,     1452451,     3930395,
+    -1957047970, 178766299,   -1777179795, 695180180,   1999506068,
+    -675310538,  1784632064,  -1321868265, 889861155,   -2135294594,
+    -289871779,  783134478,   1440787840,  1285853323,  2143979939,
+    1574918427,  -1976782,    3545687,     3833893,     -472078,
+    1799107,     1207385,     3776993,     -3406031,    1962642,
+    1050970,     -1595974,    -203044,     3595838,     522500,
+    3193378,     3562462,     -374860238,  -201262505,  -776003547,
+    -394851342,  -1726753853, -2061661095, -940195359,  -1405999311,
+    -1116720494, -1136965286, -6363718,    -1629985060, -1258381762,
+    -1926727420, -1904936414, 1420958686,  846154,      -1612842,
+    260646,      -1717735,    3694233,     -185531,     -594136,
+    -2235880,    -3306115,    -1903435,    -2486353,    -1735879,
+    768622,      43260,       1197226,     2446433,     540420426,
+    1499603926,  71875110,    279505433,   596344473,   384158533,
+    -371462360,  270590488,   -419615363,  -671509323,  642772911,
+    -137583815,  -128353682,  -2027935492, -1683520342, -30313375,
+    -1400424,    976891,      1104333,     975884,      -1652634,
+    -3369112,    3724270,     -777191,     -1312455,    -1869119,
+    -1247620,    3342277,     525098,      1613174,     3759364,
+    -2244091,    -400711272,  -879867909,  1758099917,  110126092,
+    1039370342,  2126092136,  -608791570,  -604552167,  -963438279,
+    314284737,   1354528380,  -1851023419, 325927722,   818371958,
+    -1176904444, -912367099,  -3937738,    -183443,     1667432,
+    -2213111,    -810149,     -1957272,    2584293,     -1500165,
+    451100,      2994039,     -4055324,    -3437287,    3556995,
+    -495491,     3520352,     3342478,     973777462,   -1544891539,
+    440824168,   1723816713,  853476187,   -1339088280, 260312805,
+    300448763,   1045062172,  -694382729,  1637785316,  1223601433,
+    -1819892093, -1014493059, -2027833504, 1363460238,  1362209,
+    2286327,     -1910376,    -269760,     -3014001,    164721,
+    1846953,     1374803,     1430225,     3548272,     -1265009,
+    -4108315,    -3207046,    -819034,     -3513181,    -3817976,
+    -1934038751, -1123958025, -283780712,  1547952704,  883155599,
+    1542497137,  -713994583,  -1042326957, -1779436847, 1287922800,
+    -1967222129, -885133339,  -1931587462, -1257750362, -2032221021,
+    -746144248,  48306,       420899,      1803090,     -3866901,
+    -1616392,    -2454455,    1671176,     2546312,     3318210,
+    -2635921,    2590150,     2437823,     -2031748,    -909542,
+    1235728,     -2316500,    -2036925262, 1208667171,  260424530,
+    -702390549,  -827959816,  1357098057,  1276805128,  -1216882040,
+    2070602178,  -45766801,   635454918,   1123881663,  1372618620,
+    517299994,   326425360,   -1363007700, -3919660,    2235985,
+    -1723600,    -3523897,    -162844,     -2432395,    2831860,
+    -1917081,    -1237275,    -1250494,    -2691481,    -286988,
+    3122442,     -1859098,    -2434439,    -3407706,    1809756372,
+    1600929361,  -565464272,  -6087993,    1316619236,  -173440395,
+    1021949428,  1078959975,  -985022747,  72690498,    1176751719,
+    -908452108,  -1747917558, 421552614,   44694137,    -991903578,
+    554416,      2939036,     426683,      3038916,     3183426,
+    2013608,     542412,      1279661,     1333058,     3767016,
+    -2842341,    -342297,     655327,      -900702,     -266997,
+    -2091667,    -155290192,  -1119856484, 1591599803,  2047270596,
+    2040058690,  -1554794072, -756955444,  -831969619,  -235104446,
+    1536588520,  1920467227,  -2124962073, -863641633,  -14253662,
+    605900043,   898413,
+};
+
+#else /* MLD_ARITH_BACKEND_X86_64_AVX512 */
+
+MLD_EMPTY_CU(x86_64_zetas)
+
+#endif /* !MLD_ARITH_BACKEND_X86_64_AVX512 */
@@ -7,118 +7,181 @@
 #include "ntt.h"
 #include "reduce.h"
 
-static int32_t mld_fqmul(int32_t a, int32_t b)
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mld_fqmul_precomp MLD_NAMESPACE_SHARED(fqmul_precomp)
+#define zetas MLD_NAMESPACE_SHARED(zetas)
+#define zetas_qinv MLD_NAMESPACE_SHARED(zetas_qinv)
+#define mld_ntt_butterfly_block MLD_NAMESPACE_SHARED(ntt_butterfly_block)
+#define mld_ntt_layer MLD_NAMESPACE_SHARED(ntt_layer)
+#define mld_invntt_layer MLD_NAMESPACE_SHARED(invntt_layer)
+/* End of static namespacing */
+
+/* mld_fqmul_precomp()
+ *
+ * Montgomery multiplication of a by a constant b, given together with
+ * b_qinv = b * MLDSA_Q^{-1} mod 2^32. This computes the same value as
+ * montgomery_reduce((int64_t)a * b), but the two multiplications by a are
+ * independent, which shortens the dependency chain by one multiplication.
+ *
+ * The bound on the result only depends on the bound on b, not on b_qinv
+ * being correct: |a * b| < 2^30 * MLDSA_Q and |t * MLDSA_Q| <= 2^31 *
+ * MLDSA_Q, so the result is smaller than 3/4 * MLDSA_Q in absolute value.
+ */
+static int32_t mld_fqmul_precomp(int32_t a, int32_t b, int32_t b_qinv)
 __contract__(
   requires(b > -MLDSA_Q_HALF && b < MLDSA_Q_HALF)
   ensures(return_value > -MLDSA_Q && return_value < MLDSA_Q)
 )
 {
-  return montgomery_reduce((int64_t)a * (int64_t)b);
-  /* TODO: reason about bounds */
+  /* Compute a*b*q^{-1} mod 2^32 in unsigned representatives and lift it
+   * to the signed canonical representative */
+  const int32_t t = mld_cast_uint32_to_int32((uint32_t)a * (uint32_t)b_qinv);
+  int64_t r = (int64_t)a * b - (int64_t)t * MLDSA_Q;
+
+  /*
+   * PORTABILITY: Right-shift on a signed integer is, strictly-speaking,
+   * implementation-defined for negative left argument. Here,
+   * we assume it's sign-preserving "arithmetic" shift right. (C99 6.5.7 (5))
+   */
+  r = r >> 32;
+  return (int32_t)r;
 }
 
 #include "zetas.inc"
 
+/* The NTT and its inverse are computed two layers at a time: each pass
+ * loads four coefficients, applies the butterflies of both layers to them
+ * in registers, and stores them back, halving the number of loads and
+ * stores. The twiddles are multiplied with mld_fqmul_precomp(), using the
+ * precomputed table zetas_qinv next to zetas. The result is identical to
+ * that of the layer-by-layer reference NTT. */
 
 /* mld_ntt_butterfly_block()
  *
- * Computes a block CT butterflies with a fixed twiddle factor,
- * using Montgomery multiplication.
+ * Computes a block of radix-4 butterflies: CT butterflies of layer
+ * `layer` with twiddle zetas[k], followed by those of layer `layer + 1`
+ * with twiddles zetas[2k] and zetas[2k+1].
  *
  * Parameters:
  * - r: Pointer to base of polynomial (_not_ the base of butterfly block)
- * - zeta: Twiddle factor to use for the butterfly. This must be in
- *         Montgomery form and signed canonical.
+ * - k: Index of the twiddle factor of the first layer; 1 <= k < 128
  * - start: Offset to the beginning of the butterfly block
  * - len: Index difference between coefficients subject to a butterfly
+ *        in the second layer
  * - bound: Ghost variable describing coefficient bound: Prior to `start`,
- *          coefficients must be bound by `bound + MLDSA_Q`. Post `start`,
- *          they must be bound by `bound`.
+ *          coefficients must be bound by `bound + 2 * MLDSA_Q`. Post
+ *          `start`, they must be bound by `bound`.
  * When this function returns, output coefficients in the index range
- * [start, start+2*len) have bound bumped to `bound + MLDSA_Q`.
+ * [start, start+4*len) have bound bumped to `bound + 2 * MLDSA_Q`.
  * Example:
- * - start=8, len=4
- *   This would compute the following four butterflies
- *          8     --    12
- *             9    --     13
- *                10   --     14
- *                   11   --     15
- * - start=4, len=2
- *   This would compute the following two butterflies
- *          4 -- 6
- *             5 -- 7
+ * - start=8, len=2
+ *   This would compute the following butterflies, first
+ *          8 -- 12,  9 -- 13      (layer, zetas[k])
+ *   and then
+ *          8 -- 10,  9 -- 11      (layer + 1, zetas[2k])
+ *         12 -- 14, 13 -- 15      (layer + 1, zetas[2k+1])
  */
 
 /* Reference: Embedded in `ntt()` in the reference implementation. */
-static void mld_ntt_butterfly_block(int32_t r[MLDSA_N], const int32_t zeta,
+static void mld_ntt_butterfly_block(int32_t r[MLDSA_N], const unsigned k,
                                     const unsigned start, const unsigned len,
                                     const int32_t bound)
 __contract__(
+  requires(1 <= k && k < MLDSA_N / 2)
   requires(start < MLDSA_N)
-  requires(1 <= len && len <= MLDSA_N / 2 && start + 2 * len <= MLDSA_N)
-  requires(0 <= bound && bound < INT32_MAX - MLDSA_Q)
-  requires(-MLDSA_Q_HALF < zeta && zeta < MLDSA_Q_HALF)
+  requires(1 <= len && len <= MLDSA_N / 4 && start + 4 * len <= MLDSA_N)
+  requires(0 <= bound && bound < INT32_MAX - 2 * MLDSA_Q)
   requires(memory_no_alias(r, sizeof(int32_t) * MLDSA_N))
-  requires(array_abs_bound(r, 0, start, bound + MLDSA_Q))
+  requires(array_abs_bound(r, 0, start, bound + 2 * MLDSA_Q))
   requires(array_abs_bound(r, start, MLDSA_N, bound))
   assigns(memory_slice(r, sizeof(int32_t) * MLDSA_N))
-  ensures(array_abs_bound(r, 0, start + 2*len, bound + MLDSA_Q))
-  ensures(array_abs_bound(r, start + 2 * len, MLDSA_N, bound)))
+  ensures(array_abs_bound(r, 0, start + 4 * len, bound + 2 * MLDSA_Q))
+  ensures(array_abs_bound(r, start + 4 * len, MLDSA_N, bound)))
 {
   /* `bound` is a ghost variable only needed in the CBMC specification */
   unsigned j;
+  const int32_t z1 = zetas[k], z1_qinv = zetas_qinv[k];
+  const int32_t z2 = zetas[2 * k], z2_qinv = zetas_qinv[2 * k];
+  const int32_t z3 = zetas[2 * k + 1], z3_qinv = zetas_qinv[2 * k + 1];
   ((void)bound);
   for (j = start; j < start + len; j++)
   __loop__(
     invariant(start <= j && j <= start + len)
     /*
-     * Coefficients are updated in strided pairs, so the bounds for the
-     * intermediate states alternate twice between the old and new bound
+     * Coefficients are updated in strided quadruples, so the bounds for the
+     * intermediate states alternate four times between the old and new
+     * bound
      */
-    invariant(array_abs_bound(r, 0,           j,           bound + MLDSA_Q))
-    invariant(array_abs_bound(r, j,           start + len, bound))
-    invariant(array_abs_bound(r, start + len, j + len,     bound + MLDSA_Q))
-    invariant(array_abs_bound(r, j + len,     MLDSA_N,     bound)))
+    invariant(array_abs_bound(r, 0,               j,               bound + 2 * MLDSA_Q))
+    invariant(array_abs_bound(r, j,               start + len,     bound))
+    invariant(array_abs_bound(r, start + len,     j + len,         bound + 2 * MLDSA_Q))
+    invariant(array_abs_bound(r, j + len,         start + 2 * len, bound))
+    invariant(array_abs_bound(r, start + 2 * len, j + 2 * len,     bound + 2 * MLDSA_Q))
+    invariant(array_abs_bound(r, j + 2 * len,     start + 3 * len, bound))
+    invariant(array_abs_bound(r, start + 3 * len, j + 3 * len,     bound + 2 * MLDSA_Q))
+    invariant(array_abs_bound(r, j + 3 * len,     MLDSA_N,         bound)))
   {
-    int32_t t;
-    t = mld_fqmul(r[j + len], zeta);
-    r[j + len] = r[j] - t;
-    r[j] = r[j] + t;
+    int32_t a0, a1, a2, a3, t;
+    a0 = r[j];
+    a1 = r[j + len];
+    a2 = r[j + 2 * len];
+    a3 = r[j + 3 * len];
+
+    t = mld_fqmul_precomp(a2, z1, z1_qinv);
+    a2 = a0 - t;
+    a0 = a0 + t;
+    t = mld_fqmul_precomp(a3, z1, z1_qinv);
+    a3 = a1 - t;
+    a1 = a1 + t;
+
+    t = mld_fqmul_precomp(a1, z2, z2_qinv);
+    a1 = a0 - t;
+    a0 = a0 + t;
+    t = mld_fqmul_precomp(a3, z3, z3_qinv);
+    a3 = a2 - t;
+    a2 = a2 + t;
+
+    r[j] = a0;
+    r[j + len] = a1;
+    r[j + 2 * len] = a2;
+    r[j + 3 * len] = a3;
   }
 }
 
 /* mld_ntt_layer()
  *
- * Compute one layer of forward NTT
+ * Compute two layers of forward NTT
  *
  * Parameters:
  * - r:     Pointer to base of polynomial
- * - layer: Indicates which layer is being applied.
+ * - layer: Indicates the first of the two layers being applied.
  */
 
 /* Reference: Embedded in `ntt()` in the reference implementation. */
 static void mld_ntt_layer(int32_t r[MLDSA_N], const unsigned layer)
 __contract__(
   requires(memory_no_alias(r, sizeof(int32_t) * MLDSA_N))
-  requires(1 <= layer && layer <= 8)
+  requires(layer == 1 || layer == 3 || layer == 5 || layer == 7)
   requires(array_abs_bound(r, 0, MLDSA_N, layer * MLDSA_Q))
   assigns(memory_slice(r, sizeof(int32_t) * MLDSA_N))
-  ensures(array_abs_bound(r, 0, MLDSA_N, (layer + 1) * MLDSA_Q)))
+  ensures(array_abs_bound(r, 0, MLDSA_N, (layer + 2) * MLDSA_Q)))
 {
   unsigned start, k, len;
   /* Twiddle factors for layer n are at indices 2^(n-1)..2^n-1. */
   k = 1u << (layer - 1);
-  len = MLDSA_N >> layer;
-  for (start = 0; start < MLDSA_N; start += 2 * len)
+  len = MLDSA_N >> (layer + 1);
+  for (start = 0; start < MLDSA_N; start += 4 * len)
   __loop__(
-    invariant(start < MLDSA_N + 2 * len)
-    invariant(k <= MLDSA_N)
-    invariant(2 * len * k == start + MLDSA_N)
-    invariant(array_abs_bound(r, 0, start, layer * MLDSA_Q + MLDSA_Q))
+    invariant(start < MLDSA_N + 4 * len)
+    invariant(k <= MLDSA_N / 2)
+    invariant(4 * len * k == start + MLDSA_N)
+    invariant(array_abs_bound(r, 0, start, layer * MLDSA_Q + 2 * MLDSA_Q))
     invariant(array_abs_bound(r, start, MLDSA_N, layer * MLDSA_Q)))
   {
-    int32_t zeta = zetas[k++];
-    mld_ntt_butterfly_block(r, zeta, start, len, layer * MLDSA_Q);
+    mld_ntt_butterfly_block(r, k++, start, len, layer * MLDSA_Q);
   }
 }
 
@@ -127,9 +190,9 @@ void ntt(int32_t a[MLDSA_N])
 {
   unsigned int layer;
 
-  for (layer = 1; layer < 9; layer++)
+  for (layer = 1; layer < 9; layer += 2)
   __loop__(
-    invariant(1 <= layer && layer <= 9)
+    invariant(layer == 1 || layer == 3 || layer == 5 || layer == 7 || layer == 9)
     invariant(array_abs_bound(a, 0, MLDSA_N, layer * MLDSA_Q))
   )
   {
@@ -141,41 +204,82 @@ void ntt(int32_t a[MLDSA_N])
   /* are bounded in magnitude by 9 * MLDSA_Q                 */
 }
 
+/* mld_invntt_layer()
+ *
+ * Compute two layers of inverse NTT: the GS butterflies of layer
+ * `layer`, followed by those of layer `layer - 1`.
+ *
+ * Parameters:
+ * - r:     Pointer to base of polynomial
+ * - layer: Indicates the first of the two layers being applied.
+ */
+
 /* Reference: Embedded into `invntt_tomont()` in the reference implementation
  * [@REF] */
 static void mld_invntt_layer(int32_t r[MLDSA_N], unsigned layer)
 __contract__(
   requires(memory_no_alias(r, sizeof(int32_t) * MLDSA_N))
-  requires(1 <= layer && layer <= 8)
+  requires(layer == 2 || layer == 4 || layer == 6 || layer == 8)
   requires(array_abs_bound(r, 0, MLDSA_N, (MLDSA_N >> layer) * MLDSA_Q))
   assigns(memory_slice(r, sizeof(int32_t) * MLDSA_N))
-  ensures(array_abs_bound(r, 0, MLDSA_N, (MLDSA_N >> (layer - 1)) * MLDSA_Q)))
+  ensures(array_abs_bound(r, 0, MLDSA_N, (MLDSA_N >> (layer - 2)) * MLDSA_Q)))
 {
   unsigned start, k, len;
+  /* Twiddle factors for layer n are at indices 2^(n-1)..2^n-1, and the
+   * inverse NTT uses them in reverse order. k indexes those of the second
+   * layer; the first layer uses 2k+1 and 2k. */
   len = (MLDSA_N >> layer);
-  k = (1u << layer) - 1;
-  for (start = 0; start < MLDSA_N; start += 2 * len)
+  k = (1u << (layer - 1)) - 1;
+  for (start = 0; start < MLDSA_N; start += 4 * len)
   __loop__(
-    invariant(start <= MLDSA_N && k <= 255)
-    invariant(2 * len * k + start == 2 * MLDSA_N - 2 * len)
-    invariant(array_abs_bound(r, 0, start, (MLDSA_N >> (layer - 1)) * MLDSA_Q))
+    invariant(start <= MLDSA_N && k <= 127)
+    invariant(4 * len * k + start == 2 * MLDSA_N - 4 * len)
+    invariant(array_abs_bound(r, 0, start, (MLDSA_N >> (layer - 2)) * MLDSA_Q))
     invariant(array_abs_bound(r, start, MLDSA_N, (MLDSA_N >> layer) * MLDSA_Q)))
   {
     unsigned j;
-    int32_t zeta = -zetas[k--];
+    const int32_t z1 = -zetas[k], z1_qinv = -zetas_qinv[k];
+    const int32_t z2 = -zetas[2 * k + 1], z2_qinv = -zetas_qinv[2 * k + 1];
+    const int32_t z3 = -zetas[2 * k], z3_qinv = -zetas_qinv[2 * k];
+    k--;
 
     for (j = start; j < start + len; j++)
     __loop__(
       invariant(start <= j && j <= start + len)
-      invariant(array_abs_bound(r, 0, start, (MLDSA_N >> (layer - 1)) * MLDSA_Q))
-      invariant(array_abs_bound(r, start, j, (MLDSA_N >> (layer - 1)) * MLDSA_Q))
-      invariant(array_abs_bound(r, j, start + len, (MLDSA_N >> layer) * MLDSA_Q))
-      invariant(array_abs_bound(r, start + len, MLDSA_N, (MLDSA_N >> layer) * MLDSA_Q)))
+      invariant(array_abs_bound(r, 0,               start,           (MLDSA_N >> (layer - 2)) * MLDSA_Q))
+      invariant(array_abs_bound(r, start,           j,               (MLDSA_N >> (layer - 2)) * MLDSA_Q))
+      invariant(array_abs_bound(r, j,               start + len,     (MLDSA_N >> layer)       * MLDSA_Q))
+      invariant(array_abs_bound(r, start + len,     j + len,         (MLDSA_N >> (layer - 2)) * MLDSA_Q))
+      invariant(array_abs_bound(r, j + len,         start + 2 * len, (MLDSA_N >> layer)       * MLDSA_Q))
+      invariant(array_abs_bound(r, start + 2 * len, j + 2 * len,     (MLDSA_N >> (layer - 2)) * MLDSA_Q))
+      invariant(array_abs_bound(r, j + 2 * len,     start + 3 * len, (MLDSA_N >> layer)       * MLDSA_Q))
+      invariant(array_abs_bound(r, start + 3 * len, j + 3 * len,     (MLDSA_N >> (layer - 2)) * MLDSA_Q))
+      invariant(array_abs_bound(r, j + 3 * len,     MLDSA_N,         (MLDSA_N >> layer)       * MLDSA_Q)))
     {
-      int32_t t = r[j];
-      r[j] = t + r[j + len];
-      r[j + len] = t - r[j + len];
-      r[j + len] = mld_fqmul(r[j + len], zeta);
+      int32_t a0, a1, a2, a3, t;
+      a0 = r[j];
+      a1 = r[j + len];
+      a2 = r[j + 2 * len];
+      a3 = r[j + 3 * len];
+
+      t = a0;
+      a0 = t + a1;
+      a1 = mld_fqmul_precomp(t - a1, z2, z2_qinv);
+      t = a2;
+      a2 = t + a3;
+      a3 = mld_fqmul_precomp(t - a3, z3, z3_qinv);
+
+      t = a0;
+      a0 = t + a2;
+      a2 = mld_fqmul_precomp(t - a2, z1, z1_qinv);
+      t = a1;
+      a1 = t + a3;
+      a3 = mld_fqmul_precomp(t - a3, z1, z1_qinv);
+
+      r[j] = a0;
+      r[j + len] = a1;
+      r[j + 2 * len] = a2;
+      r[j + 3 * len] = a3;
     }
   }
 }
@@ -196,10 +300,12 @@ void invntt_tomont(int32_t a[MLDSA_N])
 {
   unsigned int layer, j;
   const int32_t f = 41978; /* mont^2/256 */
+  /* check-magic: -8395782 == signed_mod(41978 * pow(MLDSA_Q, -1, 2^32), 2^32) */
+  const int32_t f_qinv = -8395782;
 
-  for (layer = 8; layer >= 1; layer--)
+  for (layer = 8; layer > 0; layer -= 2)
   __loop__(
-    invariant(layer <= 8)
+    invariant(layer == 8 || layer == 6 || layer == 4 || layer == 2 || layer == 0)
     /* Absolute bounds increase from 1Q before layer 8 */
     /* up to 256Q after layer 1                        */
     invariant(array_abs_bound(a, 0, MLDSA_N, (MLDSA_N >> layer) * MLDSA_Q)))
@@ -214,6 +320,15 @@ void invntt_tomont(int32_t a[MLDSA_N])
     invariant(j <= MLDSA_N)
     invariant(array_abs_bound(a, 0, j, MLDSA_Q)))
   {
-    a[j] = mld_fqmul(a[j], f);
+    a[j] = mld_fqmul_precomp(a[j], f, f_qinv);
   }
 }
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef mld_fqmul_precomp
+#undef zetas
+#undef zetas_qinv
+#undef mld_ntt_butterfly_block
+#undef mld_ntt_layer
+#undef mld_invntt_layer
@@ -12,7 +12,7 @@
 /* Absolute exclusive upper bound for the output of the forward NTT */
 #define MLD_NTT_BOUND (9 * MLDSA_Q)
 
-#define ntt MLD_NAMESPACE(ntt)
+#define ntt MLD_NAMESPACE_SHARED(ntt)
 /*************************************************
  * Name:        ntt
  *
@@ -33,6 +33,7 @@
  * Specification: Implements [FIPS 204, Algorithm 41, NTT]
  *
  **************************************************/
+MLD_INTERNAL_API
 void ntt(int32_t a[MLDSA_N])
 __contract__(
   requires(memory_no_alias(a, MLDSA_N * sizeof(int32_t)))
@@ -41,7 +42,7 @@ __contract__(
   ensures(array_abs_bound(a, 0, MLDSA_N, MLD_NTT_BOUND))
 );
 
-#define invntt_tomont MLD_NAMESPACE(invntt_tomont)
+#define invntt_tomont MLD_NAMESPACE_SHARED(invntt_tomont)
 /*************************************************
  * Name:        invntt_tomont
  *
@@ -53,6 +54,7 @@ __contract__(
  *
  * Arguments:   - uint32_t a[MLDSA_N]: input/output coefficient array
  **************************************************/
+MLD_INTERNAL_API
 void invntt_tomont(int32_t a[MLDSA_N])
 __contract__(
   requires(memory_no_alias(a, MLDSA_N * sizeof(int32_t)))
@@ -6,9 +6,16 @@
 
 #include "common.h"
 #include "packing.h"
-#include "poly.h"
+#include "poly_kl.h"
 #include "polyvec.h"
 
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define check_hints MLD_NAMESPACE(check_hints)
+/* End of static namespacing */
+
 void pack_pk(uint8_t pk[CRYPTO_PUBLICKEYBYTES],
              const uint8_t rho[MLDSA_SEEDBYTES], const polyveck *t1)
 {
@@ -83,113 +90,41 @@ void unpack_sk(uint8_t rho[MLDSA_SEEDBYTES], uint8_t tr[MLDSA_TRBYTES],
   polyveck_unpack_t0(t0, sk);
 }
 
-void pack_sig(uint8_t sig[CRYPTO_BYTES], const uint8_t c[MLDSA_CTILDEBYTES],
-              const polyvecl *z, const polyveck *h,
-              const unsigned int number_of_hints)
-{
-  unsigned int i, j, k;
-
-  memcpy(sig, c, MLDSA_CTILDEBYTES);
-  sig += MLDSA_CTILDEBYTES;
-
-  polyvecl_pack_z(sig, z);
-  sig += MLDSA_L * MLDSA_POLYZ_PACKEDBYTES;
-
-  /* Encode hints h */
-
-  /* The final section of sig[] is MLDSA_POLYVECH_PACKEDBYTES long, where
-   * MLDSA_POLYVECH_PACKEDBYTES = MLDSA_OMEGA + MLDSA_K
-   *
-   * The first OMEGA bytes record the index numbers of the coefficients
-   * that are not equal to 0
-   *
-   * The final K bytes record a running tally of the number of hints
-   * coming from each of the K polynomials in h.
-   *
-   * The pre-condition tells us that number_of_hints <= OMEGA, so some
-   * bytes may not be written, so we initialize all of them to zero
-   * to start.
-   */
-  memset(sig, 0, MLDSA_POLYVECH_PACKEDBYTES);
-
-  k = 0;
-  /* For each polynomial in h... */
-  for (i = 0; i < MLDSA_K; ++i)
-  __loop__(
-    assigns(i, j, k, memory_slice(sig, MLDSA_POLYVECH_PACKEDBYTES))
-    invariant(i <= MLDSA_K)
-    invariant(k <= number_of_hints)
-    invariant(number_of_hints <= MLDSA_OMEGA)
-  )
-  {
-    /* For each coefficient in that polynomial, record it as as hint */
-    /* if its value is not zero */
-    for (j = 0; j < MLDSA_N; ++j)
-    __loop__(
-      assigns(j, k, memory_slice(sig, MLDSA_POLYVECH_PACKEDBYTES))
-      invariant(i <= MLDSA_K)
-      invariant(j <= MLDSA_N)
-      invariant(k <= number_of_hints)
-      invariant(number_of_hints <= MLDSA_OMEGA)
-    )
-    {
-      /* The reference implementation implicitly relies on the total */
-      /* number of hints being less than OMEGA, assuming h is valid. */
-      /* In mldsa-native, we check this explicitly to ease proof of  */
-      /* type safety.                                                */
-      if (h->vec[i].coeffs[j] != 0 && k < number_of_hints)
-      {
-        /* The enclosing if condition AND the loop invariant infer  */
-        /* that k < MLDSA_OMEGA, so writing to sig[k] is safe and k */
-        /* can be incremented.                                      */
-        sig[k++] = j;
-      }
-    }
-    /* Having recorded all the hints for this polynomial, also   */
-    /* record the running tally into the correct "slot" for that */
-    /* coefficient in the final K bytes                          */
-    sig[MLDSA_OMEGA + i] = k;
-  }
-}
-
 /*************************************************
- * Name:        unpack_hints
+ * Name:        check_hints
  *
- * Description: Unpack raw hint bytes into a polyveck
- *              struct
+ * Description: Check that raw hint bytes are a valid encoding of a hint
+ *              vector: a list of coefficient indices, sorted within each
+ *              polynomial, followed by the cumulative number of hints
+ *              per polynomial.
  *
- * Arguments:   - polyveck *h: pointer to output hint vector h
- *              - const uint8_t packed_hints[MLDSA_POLYVECH_PACKEDBYTES]:
+ * Arguments:   - const uint8_t packed_hints[MLDSA_POLYVECH_PACKEDBYTES]:
  *                raw hint bytes
  *
  * Returns 1 in case of malformed hints; otherwise 0.
  **************************************************/
-static int unpack_hints(polyveck *h,
-                        const uint8_t packed_hints[MLDSA_POLYVECH_PACKEDBYTES])
+static int check_hints(const uint8_t packed_hints[MLDSA_POLYVECH_PACKEDBYTES])
 __contract__(
   requires(memory_no_alias(packed_hints, MLDSA_POLYVECH_PACKEDBYTES))
-  requires(memory_no_alias(h, sizeof(polyveck)))
-  assigns(object_whole(h))
-  /* All returned coefficients are either 0 or 1 */
-  ensures(forall(k1, 0, MLDSA_K,
-    array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
+  ensures(return_value == 1 || (
+    forall(k1, 0, MLDSA_K, packed_hints[MLDSA_OMEGA + k1] <= MLDSA_OMEGA) &&
+    forall(k2, 1, MLDSA_K,
+      packed_hints[MLDSA_OMEGA + k2 - 1] <= packed_hints[MLDSA_OMEGA + k2])))
   ensures(return_value >= 0 && return_value <= 1)
 )
 {
   unsigned int i, j;
   unsigned int old_hint_count;
 
-  /* Set all coefficients of all polynomials to 0.    */
-  /* Only those that are actually non-zero hints will */
-  /* be overwritten below.                            */
-  memset(h, 0, sizeof(polyveck));
-
   old_hint_count = 0;
   for (i = 0; i < MLDSA_K; ++i)
   __loop__(
     invariant(i <= MLDSA_K)
-    /* Maintain the post-condition */
-    invariant(forall(k1, 0, MLDSA_K, array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
+    invariant(old_hint_count <= MLDSA_OMEGA)
+    invariant(i == 0 || old_hint_count == packed_hints[MLDSA_OMEGA + i - 1])
+    invariant(forall(k1, 0, i, packed_hints[MLDSA_OMEGA + k1] <= MLDSA_OMEGA))
+    invariant(forall(k2, 1, i,
+      packed_hints[MLDSA_OMEGA + k2 - 1] <= packed_hints[MLDSA_OMEGA + k2]))
   )
   {
     /* Grab the hint count for the i'th polynomial */
@@ -206,21 +141,16 @@ __contract__(
     /* If new_hint_count == old_hint_count, then this polynomial has */
     /* zero hints, so this loop executes zero times and we move      */
     /* straight on to the next polynomial.                           */
-    for (j = old_hint_count; j < new_hint_count; ++j)
+    for (j = old_hint_count + 1; j < new_hint_count; ++j)
     __loop__(
-        invariant(i <= MLDSA_K)
-        /* Maintain the post-condition */
-        invariant(forall(k1, 0, MLDSA_K, array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
-      )
+      invariant(j >= old_hint_count + 1 && j <= MLDSA_OMEGA + 1)
+    )
     {
-      const uint8_t this_hint_index = packed_hints[j];
-
       /* Coefficients must be ordered for strong unforgeability */
-      if (j > old_hint_count && this_hint_index <= packed_hints[j - 1])
+      if (packed_hints[j] <= packed_hints[j - 1])
       {
         return 1;
       }
-      h->vec[i].coeffs[this_hint_index] = 1;
     }
 
     old_hint_count = new_hint_count;
@@ -229,9 +159,7 @@ __contract__(
   /* Extra indices must be zero for strong unforgeability */
   for (j = old_hint_count; j < MLDSA_OMEGA; ++j)
   __loop__(
-    invariant(j <= MLDSA_OMEGA)
-    /* Maintain the post-condition */
-    invariant(forall(k1, 0, MLDSA_K, array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
+    invariant(j >= old_hint_count && j <= MLDSA_OMEGA)
   )
   {
     if (packed_hints[j] != 0)
@@ -243,7 +171,8 @@ __contract__(
   return 0;
 }
 
-int unpack_sig(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z, polyveck *h,
+int unpack_sig(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z,
+               uint8_t h[MLDSA_POLYVECH_PACKEDBYTES],
                const uint8_t sig[CRYPTO_BYTES])
 {
   memcpy(c, sig, MLDSA_CTILDEBYTES);
@@ -252,5 +181,11 @@ int unpack_sig(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z, polyveck *h,
   polyvecl_unpack_z(z, sig);
   sig += MLDSA_L * MLDSA_POLYZ_PACKEDBYTES;
 
-  return unpack_hints(h, sig);
+  /* The hints are kept in their packed, sparse form */
+  memcpy(h, sig, MLDSA_POLYVECH_PACKEDBYTES);
+  return check_hints(h);
 }
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef check_hints
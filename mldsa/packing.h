@@ -18,6 +18,7 @@
  *              - const uint8_t rho[]: byte array containing rho
  *              - const polyveck *t1: pointer to vector t1
  **************************************************/
+MLD_INTERNAL_API
 void pack_pk(uint8_t pk[CRYPTO_PUBLICKEYBYTES],
              const uint8_t rho[MLDSA_SEEDBYTES], const polyveck *t1)
 __contract__(
@@ -44,6 +45,7 @@ __contract__(
  *              - const polyvecl *s1: pointer to vector s1
  *              - const polyveck *s2: pointer to vector s2
  **************************************************/
+MLD_INTERNAL_API
 void pack_sk(uint8_t sk[CRYPTO_SECRETKEYBYTES],
              const uint8_t rho[MLDSA_SEEDBYTES],
              const uint8_t tr[MLDSA_TRBYTES],
@@ -67,40 +69,6 @@ __contract__(
 );
 
 
-#define pack_sig MLD_NAMESPACE(pack_sig)
-/*************************************************
- * Name:        pack_sig
- *
- * Description: Bit-pack signature sig = (c, z, h).
- *
- * Arguments:   - uint8_t sig[]: output byte array
- *              - const uint8_t *c:  pointer to challenge hash length
- *                                   MLDSA_SEEDBYTES
- *              - const polyvecl *z: pointer to vector z
- *              - const polyveck *h: pointer to hint vector h
- *              - const unsigned int number_of_hints: total
- *                                   hints in *h
- *
- * Note that the number_of_hints argument is not present
- * in the reference implementation. It is added here to ease
- * proof of type safety.
- **************************************************/
-void pack_sig(uint8_t sig[CRYPTO_BYTES], const uint8_t c[MLDSA_CTILDEBYTES],
-              const polyvecl *z, const polyveck *h,
-              const unsigned int number_of_hints)
-__contract__(
-  requires(memory_no_alias(sig, CRYPTO_BYTES))
-  requires(memory_no_alias(c, MLDSA_CTILDEBYTES))
-  requires(memory_no_alias(z, sizeof(polyvecl)))
-  requires(memory_no_alias(h, sizeof(polyveck)))
-  requires(forall(k0, 0, MLDSA_L,
-    array_bound(z->vec[k0].coeffs, 0, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
-  requires(forall(k1, 0, MLDSA_K,
-    array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
-  requires(number_of_hints <= MLDSA_OMEGA)
-  assigns(object_whole(sig))
-);
-
 #define unpack_pk MLD_NAMESPACE(unpack_pk)
 /*************************************************
  * Name:        unpack_pk
@@ -111,6 +79,7 @@ __contract__(
  *              - const polyveck *t1: pointer to output vector t1
  *              - uint8_t pk[]: byte array containing bit-packed pk
  **************************************************/
+MLD_INTERNAL_API
 void unpack_pk(uint8_t rho[MLDSA_SEEDBYTES], polyveck *t1,
                const uint8_t pk[CRYPTO_PUBLICKEYBYTES])
 __contract__(
@@ -138,6 +107,7 @@ __contract__(
  *              - const polyveck *s2: pointer to output vector s2
  *              - uint8_t sk[]: byte array containing bit-packed sk
  **************************************************/
+MLD_INTERNAL_API
 void unpack_sk(uint8_t rho[MLDSA_SEEDBYTES], uint8_t tr[MLDSA_TRBYTES],
                uint8_t key[MLDSA_SEEDBYTES], polyveck *t0, polyvecl *s1,
                polyveck *s2, const uint8_t sk[CRYPTO_SECRETKEYBYTES])
@@ -171,26 +141,35 @@ __contract__(
  *
  * Arguments:   - uint8_t *c: pointer to output challenge hash
  *              - polyvecl *z: pointer to output vector z
- *              - polyveck *h: pointer to output hint vector h
+ *              - uint8_t h[]: output hints in packed form, as
+ *                consumed by polyveck_use_hint: the indices of the
+ *                hints, followed by the cumulative number of hints for
+ *                each polynomial
  *              - const uint8_t sig[]: byte array containing
  *                bit-packed signature
  *
  * Returns 1 in case of malformed signature; otherwise 0.
+ *
+ * Reference: The reference implementation unpacks the hints into a
+ *            dense polyveck.
  **************************************************/
-int unpack_sig(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z, polyveck *h,
+MLD_INTERNAL_API
+int unpack_sig(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z,
+               uint8_t h[MLDSA_POLYVECH_PACKEDBYTES],
                const uint8_t sig[CRYPTO_BYTES])
 __contract__(
   requires(memory_no_alias(sig, CRYPTO_BYTES))
   requires(memory_no_alias(c, MLDSA_CTILDEBYTES))
   requires(memory_no_alias(z, sizeof(polyvecl)))
-  requires(memory_no_alias(h, sizeof(polyveck)))
+  requires(memory_no_alias(h, MLDSA_POLYVECH_PACKEDBYTES))
   assigns(object_whole(c))
   assigns(object_whole(z))
-  assigns(object_whole(h))
+  assigns(memory_slice(h, MLDSA_POLYVECH_PACKEDBYTES))
   ensures(forall(k0, 0, MLDSA_L,
     array_bound(z->vec[k0].coeffs, 0, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
-  ensures(forall(k1, 0, MLDSA_K,
-    array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
+  ensures(return_value == 1 || (
+    forall(k1, 0, MLDSA_K, h[MLDSA_OMEGA + k1] <= MLDSA_OMEGA) &&
+    forall(k2, 1, MLDSA_K, h[MLDSA_OMEGA + k2 - 1] <= h[MLDSA_OMEGA + k2])))
   ensures(return_value >= 0 && return_value <= 1)
 );
 #endif /* !MLD_PACKING_H */
@@ -76,4 +76,14 @@
   (MLDSA_CTILDEBYTES + MLDSA_L * MLDSA_POLYZ_PACKEDBYTES + \
    MLDSA_POLYVECH_PACKEDBYTES)
 
+/* Serialized expanded keys, see expanded.h */
+#define CRYPTO_EXPANDED_PUBLICKEYBYTES \
+  (64 + MLDSA_TRBYTES + (MLDSA_K + MLDSA_K * MLDSA_L) * MLDSA_N * 4)
+#define CRYPTO_EXPANDED_SECRETKEYBYTES                     \
+  (64 + MLDSA_TRBYTES + MLDSA_SEEDBYTES + 32 +              \
+   (MLDSA_L + 2 * MLDSA_K + MLDSA_K * MLDSA_L) * MLDSA_N * 4)
+#define CRYPTO_COMPACT_SECRETKEYBYTES                        \
+  (64 + MLDSA_TRBYTES + 2 * MLDSA_SEEDBYTES +                \
+   (MLDSA_L + MLDSA_K) * MLDSA_N + MLDSA_K * MLDSA_N * 2)
+
 #endif /* !MLD_PARAMS_H */
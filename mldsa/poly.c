@@ -6,12 +6,21 @@
 #include <string.h>
 
 #include "debug.h"
+#include "fips202/fips202x4.h"
+#include "fips202/fips202x8.h"
 #include "ntt.h"
 #include "poly.h"
 #include "reduce.h"
-#include "rounding.h"
+#include "stats.h"
 #include "symmetric.h"
 
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define rej_uniform MLD_NAMESPACE_SHARED(rej_uniform)
+/* End of static namespacing */
+
 void poly_reduce(poly *a)
 {
   unsigned int i;
@@ -19,6 +28,14 @@ void poly_reduce(poly *a)
    * the underlying debug function mld_debug_check_bounds(). */
   /* mld_assert_bound(a->coeffs, MLDSA_N, INT32_MIN, REDUCE_DOMAIN_MAX); */
 
+#if defined(MLD_USE_NATIVE_REDUCE)
+  if (mld_poly_reduce_native(a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    mld_assert_bound(a->coeffs, MLDSA_N, -REDUCE_RANGE_MAX, REDUCE_RANGE_MAX);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_REDUCE */
+
   for (i = 0; i < MLDSA_N; ++i)
   __loop__(
     invariant(i <= MLDSA_N)
@@ -36,6 +53,14 @@ void poly_caddq(poly *a)
   unsigned int i;
   mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
 
+#if defined(MLD_USE_NATIVE_CADDQ)
+  if (mld_poly_caddq_native(a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_CADDQ */
+
   for (i = 0; i < MLDSA_N; ++i)
   __loop__(
     invariant(i <= MLDSA_N)
@@ -53,6 +78,14 @@ void poly_add(poly *c, const poly *a, const poly *b)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_ADD)
+  if (mld_poly_add_native(c->coeffs, a->coeffs, b->coeffs) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_ADD */
+
   for (i = 0; i < MLDSA_N; ++i)
   __loop__(
     invariant(i <= MLDSA_N)
@@ -68,6 +101,14 @@ void poly_sub(poly *c, const poly *a, const poly *b)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_SUB)
+  if (mld_poly_sub_native(c->coeffs, a->coeffs, b->coeffs) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_SUB */
+
   for (i = 0; i < MLDSA_N; ++i)
   __loop__(
     invariant(i <= MLDSA_N)
@@ -83,6 +124,13 @@ void poly_shiftl(poly *a)
   unsigned int i;
   mld_assert_abs_bound(a->coeffs, MLDSA_N, 1 << (31 - MLDSA_D));
 
+#if defined(MLD_USE_NATIVE_SHIFTL)
+  if (mld_poly_shiftl_native(a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_SHIFTL */
+
   for (i = 0; i < MLDSA_N; i++)
   __loop__(
     invariant(i <= MLDSA_N)
@@ -95,126 +143,54 @@ void poly_shiftl(poly *a)
   }
 }
 
-#if !defined(MLD_USE_NATIVE_NTT)
 void poly_ntt(poly *a)
 {
   mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
+  MLD_STATS_INC(ntts);
+#if defined(MLD_USE_NATIVE_NTT)
+  if (mld_ntt_native(a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    mld_assert_abs_bound(a->coeffs, MLDSA_N, MLD_NTT_BOUND);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_NTT */
   ntt(a->coeffs);
   mld_assert_abs_bound(a->coeffs, MLDSA_N, MLD_NTT_BOUND);
 }
-#else  /* !MLD_USE_NATIVE_NTT */
-void poly_ntt(poly *p)
-{
-  mld_assert_abs_bound(p->coeffs, MLDSA_N, MLDSA_Q);
-  mld_ntt_native(p->coeffs);
-  mld_assert_abs_bound(p->coeffs, MLDSA_N, MLD_NTT_BOUND);
-}
-#endif /* MLD_USE_NATIVE_NTT */
 
-#if !defined(MLD_USE_NATIVE_INTT)
 void poly_invntt_tomont(poly *a)
 {
   mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
+  MLD_STATS_INC(invntts);
+#if defined(MLD_USE_NATIVE_INTT)
+  if (mld_intt_native(a->coeffs) == MLD_NATIVE_FUNC_SUCCESS)
+  {
+    mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_INTT */
   invntt_tomont(a->coeffs);
   mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
 }
-#else  /* !MLD_USE_NATIVE_INTT */
-void poly_invntt_tomont(poly *a)
-{
-  mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
-  mld_intt_native(a->coeffs);
-  mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_Q);
-}
-#endif /* MLD_USE_NATIVE_INTT */
 
 void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b)
 {
   unsigned int i;
 
-  for (i = 0; i < MLDSA_N; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N))
-  {
-    c->coeffs[i] = montgomery_reduce((int64_t)a->coeffs[i] * b->coeffs[i]);
-  }
-}
-
-void poly_power2round(poly *a1, poly *a0, const poly *a)
-{
-  unsigned int i;
-  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
-
-  for (i = 0; i < MLDSA_N; ++i)
-  __loop__(
-    assigns(i, memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)))
-    invariant(i <= MLDSA_N)
-    invariant(array_bound(a0->coeffs, 0, i, -(MLD_2_POW_D/2)+1, (MLD_2_POW_D/2)+1))
-    invariant(array_bound(a1->coeffs, 0, i, 0, (MLD_2_POW_D/2)+1))
-  )
-  {
-    power2round(&a0->coeffs[i], &a1->coeffs[i], a->coeffs[i]);
-  }
-
-  mld_assert_bound(a0->coeffs, MLDSA_N, -(MLD_2_POW_D / 2) + 1,
-                   (MLD_2_POW_D / 2) + 1);
-  mld_assert_bound(a1->coeffs, MLDSA_N, 0, (MLD_2_POW_D / 2) + 1);
-}
-
-void poly_decompose(poly *a1, poly *a0, const poly *a)
-{
-  unsigned int i;
-  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
-
-  for (i = 0; i < MLDSA_N; ++i)
-  __loop__(
-    assigns(i, memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)))
-    invariant(i <= MLDSA_N)
-    invariant(array_bound(a1->coeffs, 0, i, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
-    invariant(array_abs_bound(a0->coeffs, 0, i, MLDSA_GAMMA2+1))
-  )
+#if defined(MLD_USE_NATIVE_POINTWISE_MONTGOMERY)
+  if (mld_poly_pointwise_montgomery_native(c->coeffs, a->coeffs, b->coeffs) ==
+      MLD_NATIVE_FUNC_SUCCESS)
   {
-    decompose(&a0->coeffs[i], &a1->coeffs[i], a->coeffs[i]);
+    return;
   }
-
-  mld_assert_abs_bound(a0->coeffs, MLDSA_N, MLDSA_GAMMA2 + 1);
-  mld_assert_bound(a1->coeffs, MLDSA_N, 0, (MLDSA_Q - 1) / (2 * MLDSA_GAMMA2));
-}
-
-unsigned int poly_make_hint(poly *h, const poly *a0, const poly *a1)
-{
-  unsigned int i, s = 0;
+#endif /* MLD_USE_NATIVE_POINTWISE_MONTGOMERY */
 
   for (i = 0; i < MLDSA_N; ++i)
   __loop__(
-    invariant(i <= MLDSA_N)
-    invariant(s <= i)
-  )
-  {
-    const unsigned int hint_bit = make_hint(a0->coeffs[i], a1->coeffs[i]);
-    h->coeffs[i] = hint_bit;
-    s += hint_bit;
-  }
-
-  mld_assert(s <= MLDSA_N);
-  return s;
-}
-
-void poly_use_hint(poly *b, const poly *a, const poly *h)
-{
-  unsigned int i;
-  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
-  mld_assert_bound(h->coeffs, MLDSA_N, 0, 2);
-
-  for (i = 0; i < MLDSA_N; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N)
-    invariant(array_bound(b->coeffs, 0, i, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
-  )
+    invariant(i <= MLDSA_N))
   {
-    b->coeffs[i] = use_hint(a->coeffs[i], h->coeffs[i]);
+    c->coeffs[i] = montgomery_reduce((int64_t)a->coeffs[i] * b->coeffs[i]);
   }
-
-  mld_assert_bound(b->coeffs, MLDSA_N, 0, (MLDSA_Q - 1) / (2 * MLDSA_GAMMA2));
 }
 
 /* Reference: explicitly checks the bound B to be <= (MLDSA_Q - 1) / 8).
@@ -294,6 +270,17 @@ __contract__(
   unsigned int ctr, pos;
   uint32_t t;
 
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM)
+  if (offset == 0)
+  {
+    int ret = mld_rej_uniform_native(a, target, buf, buflen);
+    if (ret != MLD_NATIVE_FUNC_FALLBACK)
+    {
+      return (unsigned int)ret;
+    }
+  }
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM */
+
   ctr = offset;
   pos = 0;
   /* pos + 3 cannot overflow due to the assumption
@@ -342,289 +329,126 @@ void poly_uniform(poly *a, const uint8_t seed[MLDSA_SEEDBYTES], uint16_t nonce)
     invariant(array_bound(a->coeffs, 0, ctr, 0, MLDSA_Q)))
   {
     stream128_squeezeblocks(buf, 1, &state);
+    MLD_STATS_INC(uniform_extra_blocks);
     ctr = rej_uniform(a->coeffs, MLDSA_N, ctr, buf, buflen);
   }
 }
 
-/*************************************************
- * Name:        rej_eta
- *
- * Description: Sample uniformly random coefficients in [-MLDSA_ETA, MLDSA_ETA]
- *by performing rejection sampling on array of random bytes.
- *
- * Arguments:   - int32_t *a:          pointer to output array (allocated)
- *              - unsigned int target: requested number of coefficients to
- *sample
- *              - unsigned int offset: number of coefficients already sampled
- *              - const uint8_t *buf:  array of random bytes to sample from
- *              - unsigned int buflen: length of array of random bytes
- *
- * Returns number of sampled coefficients. Can be smaller than target if not
- *enough random bytes were given.
- **************************************************/
-
-/* Reference: `rej_eta()` in the reference implementation [@REF].
- *            - Our signature differs from the reference implementation
- *              in that it adds the offset and always expects the base of the
- *              target buffer. This avoids shifting the buffer base in the
- *              caller, which appears tricky to reason about. */
-#if MLDSA_ETA == 2
-#define POLY_UNIFORM_ETA_NBLOCKS \
-  ((136 + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
-#elif MLDSA_ETA == 4
-#define POLY_UNIFORM_ETA_NBLOCKS \
-  ((227 + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
-#else
-#error "Invalid value of MLDSA_ETA"
-#endif
-static unsigned int rej_eta(int32_t *a, unsigned int target,
-                            unsigned int offset, const uint8_t *buf,
-                            unsigned int buflen)
-__contract__(
-  requires(offset <= target && target <= MLDSA_N)
-  requires(buflen <= (POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES))
-  requires(memory_no_alias(a, sizeof(int32_t) * target))
-  requires(memory_no_alias(buf, buflen))
-  requires(array_abs_bound(a, 0, offset, MLDSA_ETA + 1))
-  assigns(memory_slice(a, sizeof(int32_t) * target))
-  ensures(offset <= return_value && return_value <= target)
-  ensures(array_abs_bound(a, 0, return_value, MLDSA_ETA + 1))
-)
+void poly_uniform_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                     const uint8_t seed[4][MLDSA_SEEDBYTES + 2])
 {
-  unsigned int ctr, pos;
-  uint32_t t0, t1;
-
-  ctr = offset;
-  pos = 0;
-  while (ctr < target && pos < buflen)
-  __loop__(
-    invariant(offset <= ctr && ctr <= target && pos <= buflen)
-    invariant(array_abs_bound(a, 0, ctr, MLDSA_ETA + 1))
-  )
-  {
-    t0 = buf[pos] & 0x0F;
-    t1 = buf[pos++] >> 4;
-
-#if MLDSA_ETA == 2
-    if (t0 < 15)
-    {
-      t0 = t0 - (205 * t0 >> 10) * 5;
-      a[ctr++] = 2 - (int32_t)t0;
-    }
-    if (t1 < 15 && ctr < target)
-    {
-      t1 = t1 - (205 * t1 >> 10) * 5;
-      a[ctr++] = 2 - (int32_t)t1;
-    }
-#elif MLDSA_ETA == 4
-    if (t0 < 9)
-    {
-      a[ctr++] = 4 - (int32_t)t0;
-    }
-    if (t1 < 9 && ctr < target)
-    {
-      a[ctr++] = 4 - (int32_t)t1;
-    }
-#else /* MLDSA_ETA == 4 */
-#error "Invalid value of MLDSA_ETA"
-#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
-  }
-
-  return ctr;
-}
+  unsigned int ctr0, ctr1, ctr2, ctr3;
+  unsigned int buflen = POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES;
+  uint8_t buf[4][POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES];
+  mld_shake128x4ctx state;
 
-void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
-                      uint16_t nonce)
-{
-  unsigned int ctr;
-  unsigned int buflen = POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES;
-  uint8_t buf[POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES];
-  stream256_state state;
+  mld_shake128x4_absorb_once(&state, seed[0], seed[1], seed[2], seed[3],
+                             MLDSA_SEEDBYTES + 2);
+  mld_shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                               POLY_UNIFORM_NBLOCKS, &state);
 
-  stream256_init(&state, seed, nonce);
-  stream256_squeezeblocks(buf, POLY_UNIFORM_ETA_NBLOCKS, &state);
+  ctr0 = rej_uniform(a0->coeffs, MLDSA_N, 0, buf[0], buflen);
+  ctr1 = rej_uniform(a1->coeffs, MLDSA_N, 0, buf[1], buflen);
+  ctr2 = rej_uniform(a2->coeffs, MLDSA_N, 0, buf[2], buflen);
+  ctr3 = rej_uniform(a3->coeffs, MLDSA_N, 0, buf[3], buflen);
 
-  ctr = rej_eta(a->coeffs, MLDSA_N, 0, buf, buflen);
-  buflen = STREAM256_BLOCKBYTES;
-  while (ctr < MLDSA_N)
+  /* Squeeze all four instances until every polynomial is complete;
+   * rej_uniform() leaves polynomials which are already complete alone. */
+  buflen = STREAM128_BLOCKBYTES;
+  while (ctr0 < MLDSA_N || ctr1 < MLDSA_N || ctr2 < MLDSA_N || ctr3 < MLDSA_N)
+  __loop__(
+    assigns(ctr0, ctr1, ctr2, ctr3, state, object_whole(buf),
+            memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)),
+            memory_slice(a2, sizeof(poly)), memory_slice(a3, sizeof(poly)))
+    invariant(ctr0 <= MLDSA_N && ctr1 <= MLDSA_N)
+    invariant(ctr2 <= MLDSA_N && ctr3 <= MLDSA_N)
+    invariant(state.ctx[0].pos <= SHAKE128_RATE)
+    invariant(state.ctx[1].pos <= SHAKE128_RATE)
+    invariant(state.ctx[2].pos <= SHAKE128_RATE)
+    invariant(state.ctx[3].pos <= SHAKE128_RATE)
+    invariant(array_bound(a0->coeffs, 0, ctr0, 0, MLDSA_Q))
+    invariant(array_bound(a1->coeffs, 0, ctr1, 0, MLDSA_Q))
+    invariant(array_bound(a2->coeffs, 0, ctr2, 0, MLDSA_Q))
+    invariant(array_bound(a3->coeffs, 0, ctr3, 0, MLDSA_Q)))
   {
-    stream256_squeezeblocks(buf, 1, &state);
-    ctr = rej_eta(a->coeffs, MLDSA_N, ctr, buf, buflen);
+    mld_shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    MLD_STATS_INC(uniform_extra_blocks);
+    ctr0 = rej_uniform(a0->coeffs, MLDSA_N, ctr0, buf[0], buflen);
+    ctr1 = rej_uniform(a1->coeffs, MLDSA_N, ctr1, buf[1], buflen);
+    ctr2 = rej_uniform(a2->coeffs, MLDSA_N, ctr2, buf[2], buflen);
+    ctr3 = rej_uniform(a3->coeffs, MLDSA_N, ctr3, buf[3], buflen);
   }
 }
 
-#define POLY_UNIFORM_GAMMA1_NBLOCKS \
-  ((MLDSA_POLYZ_PACKEDBYTES + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
-void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
-                         uint16_t nonce)
-{
-  uint8_t buf[POLY_UNIFORM_GAMMA1_NBLOCKS * STREAM256_BLOCKBYTES];
-  stream256_state state;
-
-  stream256_init(&state, seed, nonce);
-  stream256_squeezeblocks(buf, POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
-  polyz_unpack(a, buf);
-}
-
-void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
+void poly_uniform_8x(poly *a0, poly *a1, poly *a2, poly *a3, poly *a4,
+                     poly *a5, poly *a6, poly *a7,
+                     const uint8_t seed[8][MLDSA_SEEDBYTES + 2])
 {
-  unsigned int i, j, pos;
-  uint64_t signs;
-  uint64_t offset;
-  uint8_t buf[SHAKE256_RATE];
-  keccak_state state;
-
-  shake256_init(&state);
-  shake256_absorb(&state, seed, MLDSA_CTILDEBYTES);
-  shake256_finalize(&state);
-  shake256_squeezeblocks(buf, 1, &state);
-
-  /* Convert the first 8 bytes of buf[] into an unsigned 64-bit value.   */
-  /* Each bit of that dictates the sign of the resulting challenge value */
-  signs = 0;
-  for (i = 0; i < 8; ++i)
+  poly *a[8];
+  unsigned int ctr[8];
+  unsigned int i;
+  unsigned int buflen = POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES;
+  uint8_t buf[8][POLY_UNIFORM_NBLOCKS * STREAM128_BLOCKBYTES];
+  mld_shake128x8ctx state;
+
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a[3] = a3;
+  a[4] = a4;
+  a[5] = a5;
+  a[6] = a6;
+  a[7] = a7;
+
+  mld_shake128x8_absorb_once(&state, seed[0], MLDSA_SEEDBYTES + 2);
+  mld_shake128x8_squeezeblocks(buf[0], sizeof(buf[0]), POLY_UNIFORM_NBLOCKS,
+                               &state);
+
+  for (i = 0; i < 8; i++)
   __loop__(
-    assigns(i, signs)
+    assigns(i, object_whole(ctr),
+            memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)),
+            memory_slice(a2, sizeof(poly)), memory_slice(a3, sizeof(poly)),
+            memory_slice(a4, sizeof(poly)), memory_slice(a5, sizeof(poly)),
+            memory_slice(a6, sizeof(poly)), memory_slice(a7, sizeof(poly)))
     invariant(i <= 8)
-  )
+    invariant(forall(k, 0, i, ctr[k] <= MLDSA_N &&
+                     array_bound(a[k]->coeffs, 0, ctr[k], 0, MLDSA_Q))))
   {
-    signs |= (uint64_t)buf[i] << 8 * i;
+    ctr[i] = rej_uniform(a[i]->coeffs, MLDSA_N, 0, buf[i], buflen);
   }
-  pos = 8;
 
-  memset(c, 0, sizeof(poly));
-
-  for (i = MLDSA_N - MLDSA_TAU; i < MLDSA_N; ++i)
+  /* Squeeze all eight instances until every polynomial is complete;
+   * rej_uniform() leaves polynomials which are already complete alone. */
+  buflen = STREAM128_BLOCKBYTES;
+  while (ctr[0] < MLDSA_N || ctr[1] < MLDSA_N || ctr[2] < MLDSA_N ||
+         ctr[3] < MLDSA_N || ctr[4] < MLDSA_N || ctr[5] < MLDSA_N ||
+         ctr[6] < MLDSA_N || ctr[7] < MLDSA_N)
   __loop__(
-    assigns(i, j, object_whole(buf), state, pos, memory_slice(c, sizeof(poly)), signs)
-    invariant(i >= MLDSA_N - MLDSA_TAU)
-    invariant(i <= MLDSA_N)
-    invariant(pos >= 1)
-    invariant(pos <= SHAKE256_RATE)
-    invariant((&state)->pos <= SHAKE256_RATE)
-    invariant(array_bound(c->coeffs, 0, MLDSA_N, -1, 2))
-  )
+    assigns(i, object_whole(ctr), state, object_whole(buf),
+            memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)),
+            memory_slice(a2, sizeof(poly)), memory_slice(a3, sizeof(poly)),
+            memory_slice(a4, sizeof(poly)), memory_slice(a5, sizeof(poly)),
+            memory_slice(a6, sizeof(poly)), memory_slice(a7, sizeof(poly)))
+    invariant(forall(k, 0, 8, ctr[k] <= MLDSA_N &&
+                     array_bound(a[k]->coeffs, 0, ctr[k], 0, MLDSA_Q))))
   {
-    do
+    mld_shake128x8_squeezeblocks(buf[0], sizeof(buf[0]), 1, &state);
+    MLD_STATS_INC(uniform_extra_blocks);
+    for (i = 0; i < 8; i++)
     __loop__(
-      assigns(j, object_whole(buf), state, pos)
-      invariant((&state)->pos <= SHAKE256_RATE)
-    )
+      assigns(i, object_whole(ctr),
+              memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)),
+              memory_slice(a2, sizeof(poly)), memory_slice(a3, sizeof(poly)),
+              memory_slice(a4, sizeof(poly)), memory_slice(a5, sizeof(poly)),
+              memory_slice(a6, sizeof(poly)), memory_slice(a7, sizeof(poly)))
+      invariant(i <= 8)
+      invariant(forall(k, 0, 8, ctr[k] <= MLDSA_N &&
+                       array_bound(a[k]->coeffs, 0, ctr[k], 0, MLDSA_Q))))
     {
-      if (pos >= SHAKE256_RATE)
-      {
-        shake256_squeezeblocks(buf, 1, &state);
-        pos = 0;
-      }
-      j = buf[pos++];
-    } while (j > i);
-
-    c->coeffs[i] = c->coeffs[j];
-
-    /* Reference: Compute coefficent value here in two steps to */
-    /* mixinf unsigned and signed arithmetic with implicit      */
-    /* conversions, and so that CBMC can keep track of ranges   */
-    /* to complete type-safety proof here.                      */
-
-    /* The least-significant bit of signs tells us if we want -1 or +1 */
-    offset = 2 * (signs & 1);
-
-    /* offset has value 0 or 2 here, so (1 - (int32_t) offset) has
-     * value -1 or +1 */
-    c->coeffs[j] = 1 - (int32_t)offset;
-
-    /* Move to the next bit of signs for next time */
-    signs >>= 1;
-  }
-
-  mld_assert_bound(c->coeffs, MLDSA_N, -1, 2);
-}
-
-void polyeta_pack(uint8_t *r, const poly *a)
-{
-  unsigned int i;
-  uint8_t t[8];
-
-  mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_ETA + 1);
-
-#if MLDSA_ETA == 2
-  for (i = 0; i < MLDSA_N / 8; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/8))
-  {
-    t[0] = MLDSA_ETA - a->coeffs[8 * i + 0];
-    t[1] = MLDSA_ETA - a->coeffs[8 * i + 1];
-    t[2] = MLDSA_ETA - a->coeffs[8 * i + 2];
-    t[3] = MLDSA_ETA - a->coeffs[8 * i + 3];
-    t[4] = MLDSA_ETA - a->coeffs[8 * i + 4];
-    t[5] = MLDSA_ETA - a->coeffs[8 * i + 5];
-    t[6] = MLDSA_ETA - a->coeffs[8 * i + 6];
-    t[7] = MLDSA_ETA - a->coeffs[8 * i + 7];
-
-    r[3 * i + 0] = ((t[0] >> 0) | (t[1] << 3) | (t[2] << 6)) & 0xFF;
-    r[3 * i + 1] =
-        ((t[2] >> 2) | (t[3] << 1) | (t[4] << 4) | (t[5] << 7)) & 0xFF;
-    r[3 * i + 2] = ((t[5] >> 1) | (t[6] << 2) | (t[7] << 5)) & 0xFF;
-  }
-#elif MLDSA_ETA == 4
-  for (i = 0; i < MLDSA_N / 2; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/2))
-  {
-    t[0] = MLDSA_ETA - a->coeffs[2 * i + 0];
-    t[1] = MLDSA_ETA - a->coeffs[2 * i + 1];
-    r[i] = t[0] | (t[1] << 4);
-  }
-#else /* MLDSA_ETA == 4 */
-#error "Invalid value of MLDSA_ETA"
-#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
-}
-
-void polyeta_unpack(poly *r, const uint8_t *a)
-{
-  unsigned int i;
-
-#if MLDSA_ETA == 2
-  for (i = 0; i < MLDSA_N / 8; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/8)
-    invariant(array_bound(r->coeffs, 0, i*8, -5, MLDSA_ETA + 1)))
-  {
-    r->coeffs[8 * i + 0] = (a[3 * i + 0] >> 0) & 7;
-    r->coeffs[8 * i + 1] = (a[3 * i + 0] >> 3) & 7;
-    r->coeffs[8 * i + 2] = ((a[3 * i + 0] >> 6) | (a[3 * i + 1] << 2)) & 7;
-    r->coeffs[8 * i + 3] = (a[3 * i + 1] >> 1) & 7;
-    r->coeffs[8 * i + 4] = (a[3 * i + 1] >> 4) & 7;
-    r->coeffs[8 * i + 5] = ((a[3 * i + 1] >> 7) | (a[3 * i + 2] << 1)) & 7;
-    r->coeffs[8 * i + 6] = (a[3 * i + 2] >> 2) & 7;
-    r->coeffs[8 * i + 7] = (a[3 * i + 2] >> 5) & 7;
-
-    r->coeffs[8 * i + 0] = MLDSA_ETA - r->coeffs[8 * i + 0];
-    r->coeffs[8 * i + 1] = MLDSA_ETA - r->coeffs[8 * i + 1];
-    r->coeffs[8 * i + 2] = MLDSA_ETA - r->coeffs[8 * i + 2];
-    r->coeffs[8 * i + 3] = MLDSA_ETA - r->coeffs[8 * i + 3];
-    r->coeffs[8 * i + 4] = MLDSA_ETA - r->coeffs[8 * i + 4];
-    r->coeffs[8 * i + 5] = MLDSA_ETA - r->coeffs[8 * i + 5];
-    r->coeffs[8 * i + 6] = MLDSA_ETA - r->coeffs[8 * i + 6];
-    r->coeffs[8 * i + 7] = MLDSA_ETA - r->coeffs[8 * i + 7];
-  }
-#elif MLDSA_ETA == 4
-  for (i = 0; i < MLDSA_N / 2; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/2)
-    invariant(array_bound(r->coeffs, 0, i*2, -11, MLDSA_ETA + 1)))
-  {
-    r->coeffs[2 * i + 0] = a[i] & 0x0F;
-    r->coeffs[2 * i + 1] = a[i] >> 4;
-    r->coeffs[2 * i + 0] = MLDSA_ETA - r->coeffs[2 * i + 0];
-    r->coeffs[2 * i + 1] = MLDSA_ETA - r->coeffs[2 * i + 1];
+      ctr[i] = rej_uniform(a[i]->coeffs, MLDSA_N, ctr[i], buf[i], buflen);
+    }
   }
-#else /* MLDSA_ETA == 4 */
-#error "Invalid value of MLDSA_ETA"
-#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
-
-  mld_assert_bound(r->coeffs, MLDSA_N, MLD_POLYETA_UNPACK_LOWER_BOUND,
-                   MLDSA_ETA + 1);
 }
 
 void polyt1_pack(uint8_t *r, const poly *a)
@@ -772,140 +596,7 @@ void polyt0_unpack(poly *r, const uint8_t *a)
                    (1 << (MLDSA_D - 1)) + 1);
 }
 
-void polyz_pack(uint8_t *r, const poly *a)
-{
-  unsigned int i;
-  uint32_t t[4];
-
-  mld_assert_bound(a->coeffs, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1);
-
-#if MLDSA_MODE == 2
-  for (i = 0; i < MLDSA_N / 4; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/4))
-  {
-    t[0] = MLDSA_GAMMA1 - a->coeffs[4 * i + 0];
-    t[1] = MLDSA_GAMMA1 - a->coeffs[4 * i + 1];
-    t[2] = MLDSA_GAMMA1 - a->coeffs[4 * i + 2];
-    t[3] = MLDSA_GAMMA1 - a->coeffs[4 * i + 3];
-
-    r[9 * i + 0] = (t[0]) & 0xFF;
-    r[9 * i + 1] = (t[0] >> 8) & 0xFF;
-    r[9 * i + 2] = (t[0] >> 16) & 0xFF;
-    r[9 * i + 2] |= (t[1] << 2) & 0xFF;
-    r[9 * i + 3] = (t[1] >> 6) & 0xFF;
-    r[9 * i + 4] = (t[1] >> 14) & 0xFF;
-    r[9 * i + 4] |= (t[2] << 4) & 0xFF;
-    r[9 * i + 5] = (t[2] >> 4) & 0xFF;
-    r[9 * i + 6] = (t[2] >> 12) & 0xFF;
-    r[9 * i + 6] |= (t[3] << 6) & 0xFF;
-    r[9 * i + 7] = (t[3] >> 2) & 0xFF;
-    r[9 * i + 8] = (t[3] >> 10) & 0xFF;
-  }
-#else  /* MLDSA_MODE == 2 */
-  for (i = 0; i < MLDSA_N / 2; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/2))
-  {
-    t[0] = MLDSA_GAMMA1 - a->coeffs[2 * i + 0];
-    t[1] = MLDSA_GAMMA1 - a->coeffs[2 * i + 1];
-
-    r[5 * i + 0] = (t[0]) & 0xFF;
-    r[5 * i + 1] = (t[0] >> 8) & 0xFF;
-    r[5 * i + 2] = (t[0] >> 16) & 0xFF;
-    r[5 * i + 2] |= (t[1] << 4) & 0xFF;
-    r[5 * i + 3] = (t[1] >> 4) & 0xFF;
-    r[5 * i + 4] = (t[1] >> 12) & 0xFF;
-  }
-#endif /* MLDSA_MODE != 2 */
-}
-
-void polyz_unpack(poly *r, const uint8_t *a)
-{
-  unsigned int i;
-
-#if MLDSA_MODE == 2
-  for (i = 0; i < MLDSA_N / 4; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/4)
-    invariant(array_bound(r->coeffs, 0, i*4, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
-  {
-    r->coeffs[4 * i + 0] = a[9 * i + 0];
-    r->coeffs[4 * i + 0] |= (uint32_t)a[9 * i + 1] << 8;
-    r->coeffs[4 * i + 0] |= (uint32_t)a[9 * i + 2] << 16;
-    r->coeffs[4 * i + 0] &= 0x3FFFF;
-
-    r->coeffs[4 * i + 1] = a[9 * i + 2] >> 2;
-    r->coeffs[4 * i + 1] |= (uint32_t)a[9 * i + 3] << 6;
-    r->coeffs[4 * i + 1] |= (uint32_t)a[9 * i + 4] << 14;
-    r->coeffs[4 * i + 1] &= 0x3FFFF;
-
-    r->coeffs[4 * i + 2] = a[9 * i + 4] >> 4;
-    r->coeffs[4 * i + 2] |= (uint32_t)a[9 * i + 5] << 4;
-    r->coeffs[4 * i + 2] |= (uint32_t)a[9 * i + 6] << 12;
-    r->coeffs[4 * i + 2] &= 0x3FFFF;
-
-    r->coeffs[4 * i + 3] = a[9 * i + 6] >> 6;
-    r->coeffs[4 * i + 3] |= (uint32_t)a[9 * i + 7] << 2;
-    r->coeffs[4 * i + 3] |= (uint32_t)a[9 * i + 8] << 10;
-    r->coeffs[4 * i + 3] &= 0x3FFFF;
-
-    r->coeffs[4 * i + 0] = MLDSA_GAMMA1 - r->coeffs[4 * i + 0];
-    r->coeffs[4 * i + 1] = MLDSA_GAMMA1 - r->coeffs[4 * i + 1];
-    r->coeffs[4 * i + 2] = MLDSA_GAMMA1 - r->coeffs[4 * i + 2];
-    r->coeffs[4 * i + 3] = MLDSA_GAMMA1 - r->coeffs[4 * i + 3];
-  }
-#else  /* MLDSA_MODE == 2 */
-  for (i = 0; i < MLDSA_N / 2; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/2)
-    invariant(array_bound(r->coeffs, 0, i*2, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
-  {
-    r->coeffs[2 * i + 0] = a[5 * i + 0];
-    r->coeffs[2 * i + 0] |= (uint32_t)a[5 * i + 1] << 8;
-    r->coeffs[2 * i + 0] |= (uint32_t)a[5 * i + 2] << 16;
-    r->coeffs[2 * i + 0] &= 0xFFFFF;
-
-    r->coeffs[2 * i + 1] = a[5 * i + 2] >> 4;
-    r->coeffs[2 * i + 1] |= (uint32_t)a[5 * i + 3] << 4;
-    r->coeffs[2 * i + 1] |= (uint32_t)a[5 * i + 4] << 12;
-    /* r->coeffs[2*i+1] &= 0xFFFFF; */ /* No effect, since we're anyway at 20
-                                          bits */
-
-    r->coeffs[2 * i + 0] = MLDSA_GAMMA1 - r->coeffs[2 * i + 0];
-    r->coeffs[2 * i + 1] = MLDSA_GAMMA1 - r->coeffs[2 * i + 1];
-  }
-#endif /* MLDSA_MODE != 2 */
-
-  mld_assert_bound(r->coeffs, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1);
-}
-
-void polyw1_pack(uint8_t *r, const poly *a)
-{
-  unsigned int i;
-
-#if MLDSA_MODE == 2
-  mld_assert_bound(a->coeffs, MLDSA_N, 0, 44);
-
-  for (i = 0; i < MLDSA_N / 4; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/4))
-  {
-    r[3 * i + 0] = (a->coeffs[4 * i + 0]) & 0xFF;
-    r[3 * i + 0] |= (a->coeffs[4 * i + 1] << 6) & 0xFF;
-    r[3 * i + 1] = (a->coeffs[4 * i + 1] >> 2) & 0xFF;
-    r[3 * i + 1] |= (a->coeffs[4 * i + 2] << 4) & 0xFF;
-    r[3 * i + 2] = (a->coeffs[4 * i + 2] >> 4) & 0xFF;
-    r[3 * i + 2] |= (a->coeffs[4 * i + 3] << 2) & 0xFF;
-  }
-#else  /* MLDSA_MODE == 2 */
-  mld_assert_bound(a->coeffs, MLDSA_N, 0, 16);
-
-  for (i = 0; i < MLDSA_N / 2; ++i)
-  __loop__(
-    invariant(i <= MLDSA_N/2))
-  {
-    r[i] = a->coeffs[2 * i + 0] | (a->coeffs[2 * i + 1] << 4);
-  }
-#endif /* MLDSA_MODE != 2 */
-}
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef rej_uniform
+#undef POLY_UNIFORM_NBLOCKS
@@ -0,0 +1,718 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "debug.h"
+#include "fips202/fips202x4.h"
+#include "poly_kl.h"
+#include "rounding.h"
+#include "stats.h"
+#include "symmetric.h"
+
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define rej_eta MLD_NAMESPACE(rej_eta)
+/* End of static namespacing */
+
+void poly_power2round(poly *MLD_RESTRICT a1, poly *MLD_RESTRICT a0,
+                      const poly *MLD_RESTRICT a)
+{
+  unsigned int i;
+  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
+
+#if defined(MLD_USE_NATIVE_POWER2ROUND)
+  if (mld_poly_power2round_native(a1->coeffs, a0->coeffs, a->coeffs) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    mld_assert_bound(a0->coeffs, MLDSA_N, -(MLD_2_POW_D / 2) + 1,
+                     (MLD_2_POW_D / 2) + 1);
+    mld_assert_bound(a1->coeffs, MLDSA_N, 0, (MLD_2_POW_D / 2) + 1);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POWER2ROUND */
+
+  for (i = 0; i < MLDSA_N; ++i)
+  __loop__(
+    assigns(i, memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)))
+    invariant(i <= MLDSA_N)
+    invariant(array_bound(a0->coeffs, 0, i, -(MLD_2_POW_D/2)+1, (MLD_2_POW_D/2)+1))
+    invariant(array_bound(a1->coeffs, 0, i, 0, (MLD_2_POW_D/2)+1))
+  )
+  {
+    power2round(&a0->coeffs[i], &a1->coeffs[i], a->coeffs[i]);
+  }
+
+  mld_assert_bound(a0->coeffs, MLDSA_N, -(MLD_2_POW_D / 2) + 1,
+                   (MLD_2_POW_D / 2) + 1);
+  mld_assert_bound(a1->coeffs, MLDSA_N, 0, (MLD_2_POW_D / 2) + 1);
+}
+
+void poly_decompose(poly *MLD_RESTRICT a1, poly *MLD_RESTRICT a0,
+                    const poly *MLD_RESTRICT a)
+{
+  unsigned int i;
+  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
+
+  for (i = 0; i < MLDSA_N; ++i)
+  __loop__(
+    assigns(i, memory_slice(a0, sizeof(poly)), memory_slice(a1, sizeof(poly)))
+    invariant(i <= MLDSA_N)
+    invariant(array_bound(a1->coeffs, 0, i, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
+    invariant(array_abs_bound(a0->coeffs, 0, i, MLDSA_GAMMA2+1))
+  )
+  {
+    decompose(&a0->coeffs[i], &a1->coeffs[i], a->coeffs[i]);
+  }
+
+  mld_assert_abs_bound(a0->coeffs, MLDSA_N, MLDSA_GAMMA2 + 1);
+  mld_assert_bound(a1->coeffs, MLDSA_N, 0, (MLDSA_Q - 1) / (2 * MLDSA_GAMMA2));
+}
+
+unsigned int poly_make_hint_packed(uint8_t hints[MLDSA_OMEGA], unsigned int n,
+                                   const poly *a0, const poly *a1)
+{
+  unsigned int i;
+
+  for (i = 0; i < MLDSA_N; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N)
+    invariant(n >= loop_entry(n) && n <= MLDSA_OMEGA)
+  )
+  {
+    if (make_hint(a0->coeffs[i], a1->coeffs[i]))
+    {
+      if (n == MLDSA_OMEGA)
+      {
+        return MLDSA_OMEGA + 1;
+      }
+      hints[n++] = (uint8_t)i;
+    }
+  }
+
+  return n;
+}
+
+void poly_use_hint(poly *b, const poly *a, const uint8_t *hints,
+                   unsigned int n)
+{
+  unsigned int i;
+  mld_assert_bound(a->coeffs, MLDSA_N, 0, MLDSA_Q);
+
+  /* Compute the high bits of all coefficients, as for a zero hint ... */
+  for (i = 0; i < MLDSA_N; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N)
+    invariant(array_bound(b->coeffs, 0, i, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
+  )
+  {
+    b->coeffs[i] = use_hint(a->coeffs[i], 0);
+  }
+
+  /* ... and correct those of the (at most MLDSA_OMEGA) hinted ones. */
+  for (i = 0; i < n; ++i)
+  __loop__(
+    invariant(i <= n)
+    invariant(array_bound(b->coeffs, 0, MLDSA_N, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
+  )
+  {
+    b->coeffs[hints[i]] = use_hint(a->coeffs[hints[i]], 1);
+  }
+
+  mld_assert_bound(b->coeffs, MLDSA_N, 0, (MLDSA_Q - 1) / (2 * MLDSA_GAMMA2));
+}
+
+/*************************************************
+ * Name:        rej_eta
+ *
+ * Description: Sample uniformly random coefficients in [-MLDSA_ETA, MLDSA_ETA]
+ *by performing rejection sampling on array of random bytes.
+ *
+ * Arguments:   - int32_t *a:          pointer to output array (allocated)
+ *              - unsigned int target: requested number of coefficients to
+ *sample
+ *              - unsigned int offset: number of coefficients already sampled
+ *              - const uint8_t *buf:  array of random bytes to sample from
+ *              - unsigned int buflen: length of array of random bytes
+ *
+ * Returns number of sampled coefficients. Can be smaller than target if not
+ *enough random bytes were given.
+ **************************************************/
+
+/* Reference: `rej_eta()` in the reference implementation [@REF].
+ *            - Our signature differs from the reference implementation
+ *              in that it adds the offset and always expects the base of the
+ *              target buffer. This avoids shifting the buffer base in the
+ *              caller, which appears tricky to reason about. */
+#if MLDSA_ETA == 2
+#define POLY_UNIFORM_ETA_NBLOCKS \
+  ((136 + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
+#elif MLDSA_ETA == 4
+#define POLY_UNIFORM_ETA_NBLOCKS \
+  ((227 + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
+#else
+#error "Invalid value of MLDSA_ETA"
+#endif
+static unsigned int rej_eta(int32_t *a, unsigned int target,
+                            unsigned int offset, const uint8_t *buf,
+                            unsigned int buflen)
+__contract__(
+  requires(offset <= target && target <= MLDSA_N)
+  requires(buflen <= (POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES))
+  requires(memory_no_alias(a, sizeof(int32_t) * target))
+  requires(memory_no_alias(buf, buflen))
+  requires(array_abs_bound(a, 0, offset, MLDSA_ETA + 1))
+  assigns(memory_slice(a, sizeof(int32_t) * target))
+  ensures(offset <= return_value && return_value <= target)
+  ensures(array_abs_bound(a, 0, return_value, MLDSA_ETA + 1))
+)
+{
+  unsigned int ctr, pos;
+  uint32_t t0, t1;
+
+#if defined(MLD_USE_NATIVE_REJ_UNIFORM_ETA)
+  if (offset == 0)
+  {
+    int ret = mld_rej_uniform_eta_native(a, target, buf, buflen);
+    if (ret != MLD_NATIVE_FUNC_FALLBACK)
+    {
+      return (unsigned int)ret;
+    }
+  }
+#endif /* MLD_USE_NATIVE_REJ_UNIFORM_ETA */
+
+  ctr = offset;
+  pos = 0;
+  while (ctr < target && pos < buflen)
+  __loop__(
+    invariant(offset <= ctr && ctr <= target && pos <= buflen)
+    invariant(array_abs_bound(a, 0, ctr, MLDSA_ETA + 1))
+  )
+  {
+    t0 = buf[pos] & 0x0F;
+    t1 = buf[pos++] >> 4;
+
+#if MLDSA_ETA == 2
+    if (t0 < 15)
+    {
+      t0 = t0 - (205 * t0 >> 10) * 5;
+      a[ctr++] = 2 - (int32_t)t0;
+    }
+    if (t1 < 15 && ctr < target)
+    {
+      t1 = t1 - (205 * t1 >> 10) * 5;
+      a[ctr++] = 2 - (int32_t)t1;
+    }
+#elif MLDSA_ETA == 4
+    if (t0 < 9)
+    {
+      a[ctr++] = 4 - (int32_t)t0;
+    }
+    if (t1 < 9 && ctr < target)
+    {
+      a[ctr++] = 4 - (int32_t)t1;
+    }
+#else /* MLDSA_ETA == 4 */
+#error "Invalid value of MLDSA_ETA"
+#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
+  }
+
+  return ctr;
+}
+
+void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
+                      uint16_t nonce)
+{
+  unsigned int ctr;
+  unsigned int buflen = POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES;
+  uint8_t buf[POLY_UNIFORM_ETA_NBLOCKS * STREAM256_BLOCKBYTES];
+  stream256_state state;
+
+  stream256_init(&state, seed, nonce);
+  stream256_squeezeblocks(buf, POLY_UNIFORM_ETA_NBLOCKS, &state);
+
+  ctr = rej_eta(a->coeffs, MLDSA_N, 0, buf, buflen);
+  buflen = STREAM256_BLOCKBYTES;
+  while (ctr < MLDSA_N)
+  {
+    stream256_squeezeblocks(buf, 1, &state);
+    MLD_STATS_INC(uniform_eta_extra_blocks);
+    ctr = rej_eta(a->coeffs, MLDSA_N, ctr, buf, buflen);
+  }
+}
+
+/* One block more than poly_uniform_eta() squeezes up front, since an
+ * extra block costs little when squeezed for all four instances at once */
+#define POLY_UNIFORM_ETA_4X_NBLOCKS (POLY_UNIFORM_ETA_NBLOCKS + 1)
+void poly_uniform_eta_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                         const uint8_t seed[4][MLDSA_CRHBYTES], uint16_t nonce)
+{
+  poly *a[4];
+  unsigned int ctr, i, j;
+  uint8_t in[4][MLDSA_CRHBYTES + 2];
+  uint8_t buf[4][POLY_UNIFORM_ETA_4X_NBLOCKS * STREAM256_BLOCKBYTES];
+
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a[3] = a3;
+
+  for (i = 0; i < 4; i++)
+  {
+    memcpy(in[i], seed[i], MLDSA_CRHBYTES);
+    in[i][MLDSA_CRHBYTES + 0] = nonce & 0xFF;
+    in[i][MLDSA_CRHBYTES + 1] = nonce >> 8;
+  }
+
+  mld_shake256x4(buf[0], buf[1], buf[2], buf[3], sizeof(buf[0]), in[0], in[1],
+                 in[2], in[3], MLDSA_CRHBYTES + 2);
+
+  for (i = 0; i < 4; i++)
+  {
+    ctr = 0;
+    for (j = 0; j < POLY_UNIFORM_ETA_4X_NBLOCKS; j++)
+    {
+      ctr = rej_eta(a[i]->coeffs, MLDSA_N, ctr,
+                    buf[i] + j * STREAM256_BLOCKBYTES, STREAM256_BLOCKBYTES);
+    }
+
+    /* In the rare case that this is still not enough, resample with
+     * poly_uniform_eta(), which reproduces the same stream and keeps
+     * squeezing it. */
+    if (ctr < MLDSA_N)
+    {
+      poly_uniform_eta(a[i], seed[i], nonce);
+    }
+  }
+}
+
+#define POLY_UNIFORM_GAMMA1_NBLOCKS \
+  ((MLDSA_POLYZ_PACKEDBYTES + STREAM256_BLOCKBYTES - 1) / STREAM256_BLOCKBYTES)
+void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
+                         uint16_t nonce)
+{
+  uint8_t buf[POLY_UNIFORM_GAMMA1_NBLOCKS * STREAM256_BLOCKBYTES];
+  stream256_state state;
+
+  stream256_init(&state, seed, nonce);
+  stream256_squeezeblocks(buf, POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+  polyz_unpack(a, buf);
+}
+
+void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
+{
+  unsigned int i, j, pos;
+  uint64_t signs;
+  uint64_t offset;
+  uint8_t buf[SHAKE256_RATE];
+  keccak_state state;
+
+  shake256_init(&state);
+  shake256_absorb(&state, seed, MLDSA_CTILDEBYTES);
+  shake256_finalize(&state);
+  shake256_squeezeblocks(buf, 1, &state);
+
+  /* Convert the first 8 bytes of buf[] into an unsigned 64-bit value.   */
+  /* Each bit of that dictates the sign of the resulting challenge value */
+  signs = 0;
+  for (i = 0; i < 8; ++i)
+  __loop__(
+    assigns(i, signs)
+    invariant(i <= 8)
+  )
+  {
+    signs |= (uint64_t)buf[i] << 8 * i;
+  }
+  pos = 8;
+
+  memset(c, 0, sizeof(poly));
+
+  for (i = MLDSA_N - MLDSA_TAU; i < MLDSA_N; ++i)
+  __loop__(
+    assigns(i, j, object_whole(buf), state, pos, memory_slice(c, sizeof(poly)), signs)
+    invariant(i >= MLDSA_N - MLDSA_TAU)
+    invariant(i <= MLDSA_N)
+    invariant(pos >= 1)
+    invariant(pos <= SHAKE256_RATE)
+    invariant((&state)->pos <= SHAKE256_RATE)
+    invariant(array_bound(c->coeffs, 0, MLDSA_N, -1, 2))
+  )
+  {
+    do
+    __loop__(
+      assigns(j, object_whole(buf), state, pos)
+      invariant((&state)->pos <= SHAKE256_RATE)
+    )
+    {
+      if (pos >= SHAKE256_RATE)
+      {
+        shake256_squeezeblocks(buf, 1, &state);
+        pos = 0;
+      }
+      j = buf[pos++];
+    } while (j > i);
+
+    c->coeffs[i] = c->coeffs[j];
+
+    /* Reference: Compute coefficent value here in two steps to */
+    /* mixinf unsigned and signed arithmetic with implicit      */
+    /* conversions, and so that CBMC can keep track of ranges   */
+    /* to complete type-safety proof here.                      */
+
+    /* The least-significant bit of signs tells us if we want -1 or +1 */
+    offset = 2 * (signs & 1);
+
+    /* offset has value 0 or 2 here, so (1 - (int32_t) offset) has
+     * value -1 or +1 */
+    c->coeffs[j] = 1 - (int32_t)offset;
+
+    /* Move to the next bit of signs for next time */
+    signs >>= 1;
+  }
+
+  mld_assert_bound(c->coeffs, MLDSA_N, -1, 2);
+}
+
+void poly_challenge_sparse(mld_sparse_challenge *sc, const poly *c)
+{
+  unsigned int i, n = 0;
+
+  /* A challenge has exactly MLDSA_TAU nonzero coefficients; the bound on
+   * n only matters for malformed input. */
+  for (i = 0; i < MLDSA_N && n < MLDSA_TAU; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N && n <= MLDSA_TAU)
+    invariant(array_bound(sc->sign, 0, n, -1, 2))
+  )
+  {
+    if (c->coeffs[i] != 0)
+    {
+      sc->idx[n] = (uint8_t)i;
+      sc->sign[n] = (int8_t)c->coeffs[i];
+      n++;
+    }
+  }
+  sc->n = n;
+}
+
+void poly_sparse_mul_s8(poly *r, const mld_sparse_challenge *sc,
+                        const int8_t a[MLDSA_N])
+{
+  unsigned int i, j, k;
+  int32_t s;
+
+  memset(r, 0, sizeof(poly));
+  for (i = 0; i < sc->n; ++i)
+  __loop__(
+    assigns(i, j, k, s, memory_slice(r, sizeof(poly)))
+    invariant(i <= sc->n)
+    invariant(array_abs_bound(r->coeffs, 0, MLDSA_N, i * MLDSA_ETA + 1))
+  )
+  {
+    /* Add s * X^k * a; the part of the rotation wrapping around
+     * X^N = -1 is subtracted. */
+    k = sc->idx[i];
+    s = sc->sign[i];
+    for (j = 0; j < MLDSA_N - k; ++j)
+    __loop__(
+      assigns(j, memory_slice(r, sizeof(poly)))
+      invariant(j <= MLDSA_N - k)
+      invariant(array_abs_bound(r->coeffs, 0, k, i * MLDSA_ETA + 1))
+      invariant(array_abs_bound(r->coeffs, k, k + j, (i + 1) * MLDSA_ETA + 1))
+      invariant(array_abs_bound(r->coeffs, k + j, MLDSA_N, i * MLDSA_ETA + 1))
+    )
+    {
+      r->coeffs[k + j] += s * a[j];
+    }
+    for (j = MLDSA_N - k; j < MLDSA_N; ++j)
+    __loop__(
+      assigns(j, memory_slice(r, sizeof(poly)))
+      invariant(j >= MLDSA_N - k && j <= MLDSA_N)
+      invariant(array_abs_bound(r->coeffs, 0, k + j - MLDSA_N, (i + 1) * MLDSA_ETA + 1))
+      invariant(array_abs_bound(r->coeffs, k + j - MLDSA_N, k, i * MLDSA_ETA + 1))
+      invariant(array_abs_bound(r->coeffs, k, MLDSA_N, (i + 1) * MLDSA_ETA + 1))
+    )
+    {
+      r->coeffs[k + j - MLDSA_N] -= s * a[j];
+    }
+  }
+}
+
+void poly_sparse_mul_s16(poly *r, const mld_sparse_challenge *sc,
+                         const int16_t a[MLDSA_N])
+{
+  unsigned int i, j, k;
+  int32_t s;
+
+  memset(r, 0, sizeof(poly));
+  for (i = 0; i < sc->n; ++i)
+  __loop__(
+    assigns(i, j, k, s, memory_slice(r, sizeof(poly)))
+    invariant(i <= sc->n)
+    invariant(array_abs_bound(r->coeffs, 0, MLDSA_N, i * (1 << (MLDSA_D - 1)) + 1))
+  )
+  {
+    /* Add s * X^k * a; the part of the rotation wrapping around
+     * X^N = -1 is subtracted. */
+    k = sc->idx[i];
+    s = sc->sign[i];
+    for (j = 0; j < MLDSA_N - k; ++j)
+    __loop__(
+      assigns(j, memory_slice(r, sizeof(poly)))
+      invariant(j <= MLDSA_N - k)
+      invariant(array_abs_bound(r->coeffs, 0, k, i * (1 << (MLDSA_D - 1)) + 1))
+      invariant(array_abs_bound(r->coeffs, k, k + j, (i + 1) * (1 << (MLDSA_D - 1)) + 1))
+      invariant(array_abs_bound(r->coeffs, k + j, MLDSA_N, i * (1 << (MLDSA_D - 1)) + 1))
+    )
+    {
+      r->coeffs[k + j] += s * a[j];
+    }
+    for (j = MLDSA_N - k; j < MLDSA_N; ++j)
+    __loop__(
+      assigns(j, memory_slice(r, sizeof(poly)))
+      invariant(j >= MLDSA_N - k && j <= MLDSA_N)
+      invariant(array_abs_bound(r->coeffs, 0, k + j - MLDSA_N, (i + 1) * (1 << (MLDSA_D - 1)) + 1))
+      invariant(array_abs_bound(r->coeffs, k + j - MLDSA_N, k, i * (1 << (MLDSA_D - 1)) + 1))
+      invariant(array_abs_bound(r->coeffs, k, MLDSA_N, (i + 1) * (1 << (MLDSA_D - 1)) + 1))
+    )
+    {
+      r->coeffs[k + j - MLDSA_N] -= s * a[j];
+    }
+  }
+}
+
+void polyeta_pack(uint8_t *r, const poly *a)
+{
+  unsigned int i;
+  uint8_t t[8];
+
+  mld_assert_abs_bound(a->coeffs, MLDSA_N, MLDSA_ETA + 1);
+
+#if MLDSA_ETA == 2
+  for (i = 0; i < MLDSA_N / 8; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/8))
+  {
+    t[0] = MLDSA_ETA - a->coeffs[8 * i + 0];
+    t[1] = MLDSA_ETA - a->coeffs[8 * i + 1];
+    t[2] = MLDSA_ETA - a->coeffs[8 * i + 2];
+    t[3] = MLDSA_ETA - a->coeffs[8 * i + 3];
+    t[4] = MLDSA_ETA - a->coeffs[8 * i + 4];
+    t[5] = MLDSA_ETA - a->coeffs[8 * i + 5];
+    t[6] = MLDSA_ETA - a->coeffs[8 * i + 6];
+    t[7] = MLDSA_ETA - a->coeffs[8 * i + 7];
+
+    r[3 * i + 0] = ((t[0] >> 0) | (t[1] << 3) | (t[2] << 6)) & 0xFF;
+    r[3 * i + 1] =
+        ((t[2] >> 2) | (t[3] << 1) | (t[4] << 4) | (t[5] << 7)) & 0xFF;
+    r[3 * i + 2] = ((t[5] >> 1) | (t[6] << 2) | (t[7] << 5)) & 0xFF;
+  }
+#elif MLDSA_ETA == 4
+  for (i = 0; i < MLDSA_N / 2; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/2))
+  {
+    t[0] = MLDSA_ETA - a->coeffs[2 * i + 0];
+    t[1] = MLDSA_ETA - a->coeffs[2 * i + 1];
+    r[i] = t[0] | (t[1] << 4);
+  }
+#else /* MLDSA_ETA == 4 */
+#error "Invalid value of MLDSA_ETA"
+#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
+}
+
+void polyeta_unpack(poly *r, const uint8_t *a)
+{
+  unsigned int i;
+
+#if MLDSA_ETA == 2
+  for (i = 0; i < MLDSA_N / 8; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/8)
+    invariant(array_bound(r->coeffs, 0, i*8, -5, MLDSA_ETA + 1)))
+  {
+    r->coeffs[8 * i + 0] = (a[3 * i + 0] >> 0) & 7;
+    r->coeffs[8 * i + 1] = (a[3 * i + 0] >> 3) & 7;
+    r->coeffs[8 * i + 2] = ((a[3 * i + 0] >> 6) | (a[3 * i + 1] << 2)) & 7;
+    r->coeffs[8 * i + 3] = (a[3 * i + 1] >> 1) & 7;
+    r->coeffs[8 * i + 4] = (a[3 * i + 1] >> 4) & 7;
+    r->coeffs[8 * i + 5] = ((a[3 * i + 1] >> 7) | (a[3 * i + 2] << 1)) & 7;
+    r->coeffs[8 * i + 6] = (a[3 * i + 2] >> 2) & 7;
+    r->coeffs[8 * i + 7] = (a[3 * i + 2] >> 5) & 7;
+
+    r->coeffs[8 * i + 0] = MLDSA_ETA - r->coeffs[8 * i + 0];
+    r->coeffs[8 * i + 1] = MLDSA_ETA - r->coeffs[8 * i + 1];
+    r->coeffs[8 * i + 2] = MLDSA_ETA - r->coeffs[8 * i + 2];
+    r->coeffs[8 * i + 3] = MLDSA_ETA - r->coeffs[8 * i + 3];
+    r->coeffs[8 * i + 4] = MLDSA_ETA - r->coeffs[8 * i + 4];
+    r->coeffs[8 * i + 5] = MLDSA_ETA - r->coeffs[8 * i + 5];
+    r->coeffs[8 * i + 6] = MLDSA_ETA - r->coeffs[8 * i + 6];
+    r->coeffs[8 * i + 7] = MLDSA_ETA - r->coeffs[8 * i + 7];
+  }
+#elif MLDSA_ETA == 4
+  for (i = 0; i < MLDSA_N / 2; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/2)
+    invariant(array_bound(r->coeffs, 0, i*2, -11, MLDSA_ETA + 1)))
+  {
+    r->coeffs[2 * i + 0] = a[i] & 0x0F;
+    r->coeffs[2 * i + 1] = a[i] >> 4;
+    r->coeffs[2 * i + 0] = MLDSA_ETA - r->coeffs[2 * i + 0];
+    r->coeffs[2 * i + 1] = MLDSA_ETA - r->coeffs[2 * i + 1];
+  }
+#else /* MLDSA_ETA == 4 */
+#error "Invalid value of MLDSA_ETA"
+#endif /* MLDSA_ETA != 2 && MLDSA_ETA != 4 */
+
+  mld_assert_bound(r->coeffs, MLDSA_N, MLD_POLYETA_UNPACK_LOWER_BOUND,
+                   MLDSA_ETA + 1);
+}
+
+void polyz_pack(uint8_t *r, const poly *a)
+{
+  unsigned int i;
+  uint32_t t[4];
+
+  mld_assert_bound(a->coeffs, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1);
+
+#if MLDSA_MODE == 2
+  for (i = 0; i < MLDSA_N / 4; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/4))
+  {
+    t[0] = MLDSA_GAMMA1 - a->coeffs[4 * i + 0];
+    t[1] = MLDSA_GAMMA1 - a->coeffs[4 * i + 1];
+    t[2] = MLDSA_GAMMA1 - a->coeffs[4 * i + 2];
+    t[3] = MLDSA_GAMMA1 - a->coeffs[4 * i + 3];
+
+    r[9 * i + 0] = (t[0]) & 0xFF;
+    r[9 * i + 1] = (t[0] >> 8) & 0xFF;
+    r[9 * i + 2] = (t[0] >> 16) & 0xFF;
+    r[9 * i + 2] |= (t[1] << 2) & 0xFF;
+    r[9 * i + 3] = (t[1] >> 6) & 0xFF;
+    r[9 * i + 4] = (t[1] >> 14) & 0xFF;
+    r[9 * i + 4] |= (t[2] << 4) & 0xFF;
+    r[9 * i + 5] = (t[2] >> 4) & 0xFF;
+    r[9 * i + 6] = (t[2] >> 12) & 0xFF;
+    r[9 * i + 6] |= (t[3] << 6) & 0xFF;
+    r[9 * i + 7] = (t[3] >> 2) & 0xFF;
+    r[9 * i + 8] = (t[3] >> 10) & 0xFF;
+  }
+#else  /* MLDSA_MODE == 2 */
+  for (i = 0; i < MLDSA_N / 2; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/2))
+  {
+    t[0] = MLDSA_GAMMA1 - a->coeffs[2 * i + 0];
+    t[1] = MLDSA_GAMMA1 - a->coeffs[2 * i + 1];
+
+    r[5 * i + 0] = (t[0]) & 0xFF;
+    r[5 * i + 1] = (t[0] >> 8) & 0xFF;
+    r[5 * i + 2] = (t[0] >> 16) & 0xFF;
+    r[5 * i + 2] |= (t[1] << 4) & 0xFF;
+    r[5 * i + 3] = (t[1] >> 4) & 0xFF;
+    r[5 * i + 4] = (t[1] >> 12) & 0xFF;
+  }
+#endif /* MLDSA_MODE != 2 */
+}
+
+void polyz_unpack(poly *r, const uint8_t *a)
+{
+  unsigned int i;
+
+#if MLDSA_MODE == 2
+  for (i = 0; i < MLDSA_N / 4; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/4)
+    invariant(array_bound(r->coeffs, 0, i*4, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
+  {
+    r->coeffs[4 * i + 0] = a[9 * i + 0];
+    r->coeffs[4 * i + 0] |= (uint32_t)a[9 * i + 1] << 8;
+    r->coeffs[4 * i + 0] |= (uint32_t)a[9 * i + 2] << 16;
+    r->coeffs[4 * i + 0] &= 0x3FFFF;
+
+    r->coeffs[4 * i + 1] = a[9 * i + 2] >> 2;
+    r->coeffs[4 * i + 1] |= (uint32_t)a[9 * i + 3] << 6;
+    r->coeffs[4 * i + 1] |= (uint32_t)a[9 * i + 4] << 14;
+    r->coeffs[4 * i + 1] &= 0x3FFFF;
+
+    r->coeffs[4 * i + 2] = a[9 * i + 4] >> 4;
+    r->coeffs[4 * i + 2] |= (uint32_t)a[9 * i + 5] << 4;
+    r->coeffs[4 * i + 2] |= (uint32_t)a[9 * i + 6] << 12;
+    r->coeffs[4 * i + 2] &= 0x3FFFF;
+
+    r->coeffs[4 * i + 3] = a[9 * i + 6] >> 6;
+    r->coeffs[4 * i + 3] |= (uint32_t)a[9 * i + 7] << 2;
+    r->coeffs[4 * i + 3] |= (uint32_t)a[9 * i + 8] << 10;
+    r->coeffs[4 * i + 3] &= 0x3FFFF;
+
+    r->coeffs[4 * i + 0] = MLDSA_GAMMA1 - r->coeffs[4 * i + 0];
+    r->coeffs[4 * i + 1] = MLDSA_GAMMA1 - r->coeffs[4 * i + 1];
+    r->coeffs[4 * i + 2] = MLDSA_GAMMA1 - r->coeffs[4 * i + 2];
+    r->coeffs[4 * i + 3] = MLDSA_GAMMA1 - r->coeffs[4 * i + 3];
+  }
+#else  /* MLDSA_MODE == 2 */
+  for (i = 0; i < MLDSA_N / 2; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/2)
+    invariant(array_bound(r->coeffs, 0, i*2, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1)))
+  {
+    r->coeffs[2 * i + 0] = a[5 * i + 0];
+    r->coeffs[2 * i + 0] |= (uint32_t)a[5 * i + 1] << 8;
+    r->coeffs[2 * i + 0] |= (uint32_t)a[5 * i + 2] << 16;
+    r->coeffs[2 * i + 0] &= 0xFFFFF;
+
+    r->coeffs[2 * i + 1] = a[5 * i + 2] >> 4;
+    r->coeffs[2 * i + 1] |= (uint32_t)a[5 * i + 3] << 4;
+    r->coeffs[2 * i + 1] |= (uint32_t)a[5 * i + 4] << 12;
+    /* r->coeffs[2*i+1] &= 0xFFFFF; */ /* No effect, since we're anyway at 20
+                                          bits */
+
+    r->coeffs[2 * i + 0] = MLDSA_GAMMA1 - r->coeffs[2 * i + 0];
+    r->coeffs[2 * i + 1] = MLDSA_GAMMA1 - r->coeffs[2 * i + 1];
+  }
+#endif /* MLDSA_MODE != 2 */
+
+  mld_assert_bound(r->coeffs, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1);
+}
+
+void polyw1_pack(uint8_t *r, const poly *a)
+{
+  unsigned int i;
+
+#if MLDSA_MODE == 2
+  mld_assert_bound(a->coeffs, MLDSA_N, 0, 44);
+
+  for (i = 0; i < MLDSA_N / 4; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/4))
+  {
+    r[3 * i + 0] = (a->coeffs[4 * i + 0]) & 0xFF;
+    r[3 * i + 0] |= (a->coeffs[4 * i + 1] << 6) & 0xFF;
+    r[3 * i + 1] = (a->coeffs[4 * i + 1] >> 2) & 0xFF;
+    r[3 * i + 1] |= (a->coeffs[4 * i + 2] << 4) & 0xFF;
+    r[3 * i + 2] = (a->coeffs[4 * i + 2] >> 4) & 0xFF;
+    r[3 * i + 2] |= (a->coeffs[4 * i + 3] << 2) & 0xFF;
+  }
+#else  /* MLDSA_MODE == 2 */
+  mld_assert_bound(a->coeffs, MLDSA_N, 0, 16);
+
+  for (i = 0; i < MLDSA_N / 2; ++i)
+  __loop__(
+    invariant(i <= MLDSA_N/2))
+  {
+    r[i] = a->coeffs[2 * i + 0] | (a->coeffs[2 * i + 1] << 4);
+  }
+#endif /* MLDSA_MODE != 2 */
+}
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef rej_eta
+#undef POLY_UNIFORM_ETA_NBLOCKS
+#undef POLY_UNIFORM_ETA_4X_NBLOCKS
+#undef POLY_UNIFORM_GAMMA1_NBLOCKS
@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_POLY_KL_H
+#define MLD_POLY_KL_H
+
+#include <stdint.h>
+#include "cbmc.h"
+#include "common.h"
+#include "poly.h"
+#include "rounding.h"
+
+#define poly_power2round MLD_NAMESPACE(poly_power2round)
+/*************************************************
+ * Name:        poly_power2round
+ *
+ * Description: For all coefficients c of the input polynomial,
+ *              compute c0, c1 such that c mod MLDSA_Q = c1*2^MLDSA_D + c0
+ *              with -2^{MLDSA_D-1} < c0 <= 2^{MLDSA_D-1}. Assumes coefficients
+ *to be standard representatives.
+ *
+ * Arguments:   - poly *a1: pointer to output polynomial with coefficients c1
+ *              - poly *a0: pointer to output polynomial with coefficients c0
+ *              - const poly *a: pointer to input polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void poly_power2round(poly *MLD_RESTRICT a1, poly *MLD_RESTRICT a0,
+                      const poly *MLD_RESTRICT a)
+__contract__(
+  requires(memory_no_alias(a0, sizeof(poly)))
+  requires(memory_no_alias(a1, sizeof(poly)))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, 0, MLDSA_Q))
+  assigns(memory_slice(a1, sizeof(poly)))
+  assigns(memory_slice(a0, sizeof(poly)))
+  ensures(array_bound(a0->coeffs, 0, MLDSA_N, -(MLD_2_POW_D/2)+1, (MLD_2_POW_D/2)+1))
+  ensures(array_bound(a1->coeffs, 0, MLDSA_N, 0, (MLD_2_POW_D/2)+1))
+);
+
+#define poly_decompose MLD_NAMESPACE(poly_decompose)
+/*************************************************
+ * Name:        poly_decompose
+ *
+ * Description: For all coefficients c of the input polynomial,
+ *              compute high and low bits c0, c1 such c mod MLDSA_Q = c1*ALPHA +
+ *              c0 with -ALPHA/2 < c0 <= ALPHA/2 except
+ *              c1 = (MLDSA_Q-1)/ALPHA where we set
+ *              c1 = 0 and -ALPHA/2 <= c0 = c mod MLDSA_Q - MLDSA_Q < 0.
+ *              Assumes coefficients to be standard representatives.
+ *
+ * Arguments:   - poly *a1: pointer to output polynomial with coefficients c1
+ *              - poly *a0: pointer to output polynomial with coefficients c0
+ *              - const poly *a: pointer to input polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void poly_decompose(poly *MLD_RESTRICT a1, poly *MLD_RESTRICT a0,
+                    const poly *MLD_RESTRICT a)
+__contract__(
+  requires(memory_no_alias(a1,  sizeof(poly)))
+  requires(memory_no_alias(a0, sizeof(poly)))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, 0, MLDSA_Q))
+  assigns(object_whole(a1))
+  assigns(object_whole(a0))
+  ensures(array_bound(a1->coeffs, 0, MLDSA_N, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
+  ensures(array_abs_bound(a0->coeffs, 0, MLDSA_N, MLDSA_GAMMA2+1))
+);
+
+#define poly_make_hint_packed MLD_NAMESPACE(poly_make_hint_packed)
+/*************************************************
+ * Name:        poly_make_hint_packed
+ *
+ * Description: Compute the hints of a polynomial and append the indices
+ *              of the set hint bits to a packed hint list such as the one
+ *              in a signature. A hint bit indicates whether the low bits
+ *              of a coefficient overflow into its high bits.
+ *
+ * Arguments:   - uint8_t hints[]: pointer to list of hint indices
+ *                (MLDSA_OMEGA bytes)
+ *              - unsigned int n: number of indices already in the list
+ *              - const poly *a0: pointer to low part of input polynomial
+ *              - const poly *a1: pointer to high part of input polynomial
+ *
+ * Returns the new number of indices in the list, or MLDSA_OMEGA + 1 if
+ * the list overflows, in which case it is left incomplete.
+ **************************************************/
+MLD_INTERNAL_API
+unsigned int poly_make_hint_packed(uint8_t hints[MLDSA_OMEGA], unsigned int n,
+                                   const poly *a0, const poly *a1)
+__contract__(
+  requires(n <= MLDSA_OMEGA)
+  requires(memory_no_alias(hints, MLDSA_OMEGA))
+  requires(memory_no_alias(a0, sizeof(poly)))
+  requires(memory_no_alias(a1, sizeof(poly)))
+  assigns(memory_slice(hints, MLDSA_OMEGA))
+  ensures(return_value >= n && return_value <= MLDSA_OMEGA + 1)
+);
+
+#define poly_use_hint MLD_NAMESPACE(poly_use_hint)
+/*************************************************
+ * Name:        poly_use_hint
+ *
+ * Description: Use hints to correct the high bits of a polynomial.
+ *              The hints are given sparsely, as the list of indices of
+ *              the coefficients whose hint bit is set.
+ *
+ * Arguments:   - poly *b: pointer to output polynomial with corrected high bits
+ *              - const poly *a: pointer to input polynomial
+ *              - const uint8_t *hints: pointer to indices of the hints
+ *              - unsigned int n: number of hints
+ *
+ * Reference: The reference implementation takes a dense hint polynomial.
+ **************************************************/
+MLD_INTERNAL_API
+void poly_use_hint(poly *b, const poly *a, const uint8_t *hints,
+                   unsigned int n)
+__contract__(
+  requires(n <= MLDSA_N)
+  requires(memory_no_alias(a,  sizeof(poly)))
+  requires(memory_no_alias(b, sizeof(poly)))
+  requires(memory_no_alias(hints, n))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, 0, MLDSA_Q))
+  assigns(memory_slice(b, sizeof(poly)))
+  ensures(array_bound(b->coeffs, 0, MLDSA_N, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2)))
+);
+
+#define poly_uniform_eta MLD_NAMESPACE(poly_uniform_eta)
+/*************************************************
+ * Name:        poly_uniform_eta
+ *
+ * Description: Sample polynomial with uniformly random coefficients
+ *              in [-MLDSA_ETA,MLDSA_ETA] by performing rejection sampling on
+ *              the output stream from SHAKE256(seed|nonce)
+ *
+ * Arguments:   - poly *a: pointer to output polynomial
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_CRHBYTES
+ *              - uint16_t nonce: 2-byte nonce
+ **************************************************/
+MLD_INTERNAL_API
+void poly_uniform_eta(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
+                      uint16_t nonce);
+
+#define poly_uniform_eta_4x MLD_NAMESPACE(poly_uniform_eta_4x)
+/*************************************************
+ * Name:        poly_uniform_eta_4x
+ *
+ * Description: Equivalent to four calls to poly_uniform_eta() with the
+ *              same nonce, sampling the four polynomials in parallel
+ *              via mld_shake256x4().
+ *
+ * Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+ *              - const uint8_t seed[][]: the four seeds, each of length
+ *                MLDSA_CRHBYTES
+ *              - uint16_t nonce: 2-byte nonce
+ **************************************************/
+MLD_INTERNAL_API
+void poly_uniform_eta_4x(poly *a0, poly *a1, poly *a2, poly *a3,
+                         const uint8_t seed[4][MLDSA_CRHBYTES], uint16_t nonce)
+__contract__(
+  requires(memory_no_alias(a0, sizeof(poly)))
+  requires(memory_no_alias(a1, sizeof(poly)))
+  requires(memory_no_alias(a2, sizeof(poly)))
+  requires(memory_no_alias(a3, sizeof(poly)))
+  requires(memory_no_alias(seed, 4 * MLDSA_CRHBYTES))
+  assigns(memory_slice(a0, sizeof(poly)))
+  assigns(memory_slice(a1, sizeof(poly)))
+  assigns(memory_slice(a2, sizeof(poly)))
+  assigns(memory_slice(a3, sizeof(poly)))
+  ensures(array_abs_bound(a0->coeffs, 0, MLDSA_N, MLDSA_ETA + 1))
+  ensures(array_abs_bound(a1->coeffs, 0, MLDSA_N, MLDSA_ETA + 1))
+  ensures(array_abs_bound(a2->coeffs, 0, MLDSA_N, MLDSA_ETA + 1))
+  ensures(array_abs_bound(a3->coeffs, 0, MLDSA_N, MLDSA_ETA + 1))
+);
+
+#define poly_uniform_gamma1 MLD_NAMESPACE(poly_uniform_gamma1)
+/*************************************************
+ * Name:        poly_uniform_gamma1m1
+ *
+ * Description: Sample polynomial with uniformly random coefficients
+ *              in [-(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1] by unpacking output
+ *              stream of SHAKE256(seed|nonce)
+ *
+ * Arguments:   - poly *a: pointer to output polynomial
+ *              - const uint8_t seed[]: byte array with seed of length
+ *                MLDSA_CRHBYTES
+ *              - uint16_t nonce: 16-bit nonce
+ **************************************************/
+MLD_INTERNAL_API
+void poly_uniform_gamma1(poly *a, const uint8_t seed[MLDSA_CRHBYTES],
+                         uint16_t nonce);
+
+#define poly_challenge MLD_NAMESPACE(poly_challenge)
+/*************************************************
+ * Name:        poly_challenge
+ *
+ * Description: Implementation of H. Samples polynomial with MLDSA_TAU nonzero
+ *              coefficients in {-1,1} using the output stream of
+ *              SHAKE256(seed).
+ *
+ * Arguments:   - poly *c: pointer to output polynomial
+ *              - const uint8_t mu[]: byte array containing seed of length
+ *                MLDSA_CTILDEBYTES
+ **************************************************/
+MLD_INTERNAL_API
+void poly_challenge(poly *c, const uint8_t seed[MLDSA_CTILDEBYTES])
+__contract__(
+  requires(memory_no_alias(c, sizeof(poly)))
+  requires(memory_no_alias(seed, MLDSA_CTILDEBYTES))
+  assigns(memory_slice(c, sizeof(poly)))
+  /* All coefficients of c are -1, 0 or +1 */
+  ensures(array_bound(c->coeffs, 0, MLDSA_N, -1, 2))
+);
+
+#define mld_sparse_challenge MLD_NAMESPACE(sparse_challenge)
+/* Sparse representation of a challenge polynomial c: the n nonzero
+ * coefficients are c[idx[i]] = sign[i], for i < n. */
+typedef struct
+{
+  unsigned int n;
+  uint8_t idx[MLDSA_TAU];
+  int8_t sign[MLDSA_TAU];
+} mld_sparse_challenge;
+
+#define poly_challenge_sparse MLD_NAMESPACE(poly_challenge_sparse)
+/*************************************************
+ * Name:        poly_challenge_sparse
+ *
+ * Description: Convert a challenge polynomial, as output by
+ *              poly_challenge, to its sparse representation.
+ *
+ * Arguments:   - mld_sparse_challenge *sc: pointer to output sparse
+ *                challenge
+ *              - const poly *c: pointer to input challenge polynomial,
+ *                in normal domain
+ **************************************************/
+MLD_INTERNAL_API
+void poly_challenge_sparse(mld_sparse_challenge *sc, const poly *c)
+__contract__(
+  requires(memory_no_alias(sc, sizeof(mld_sparse_challenge)))
+  requires(memory_no_alias(c, sizeof(poly)))
+  requires(array_bound(c->coeffs, 0, MLDSA_N, -1, 2))
+  assigns(memory_slice(sc, sizeof(mld_sparse_challenge)))
+  ensures(sc->n <= MLDSA_TAU)
+  ensures(array_bound(sc->sign, 0, sc->n, -1, 2))
+);
+
+#define poly_sparse_mul_s8 MLD_NAMESPACE(poly_sparse_mul_s8)
+/*************************************************
+ * Name:        poly_sparse_mul_s8
+ *
+ * Description: Multiplication of a polynomial with small coefficients in
+ *              [-MLDSA_ETA, MLDSA_ETA] by a sparse challenge, in
+ *              Z[X]/(X^N + 1) and in normal domain. Output coefficients
+ *              are exact, i.e. not reduced.
+ *
+ * Arguments:   - poly *r: pointer to output polynomial
+ *              - const mld_sparse_challenge *sc: pointer to sparse
+ *                challenge
+ *              - const int8_t a[]: input coefficients
+ **************************************************/
+MLD_INTERNAL_API
+void poly_sparse_mul_s8(poly *r, const mld_sparse_challenge *sc,
+                        const int8_t a[MLDSA_N])
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly)))
+  requires(memory_no_alias(sc, sizeof(mld_sparse_challenge)))
+  requires(memory_no_alias(a, MLDSA_N))
+  requires(sc->n <= MLDSA_TAU)
+  requires(array_bound(sc->sign, 0, sc->n, -1, 2))
+  requires(array_abs_bound(a, 0, MLDSA_N, MLDSA_ETA + 1))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_abs_bound(r->coeffs, 0, MLDSA_N, MLDSA_TAU * MLDSA_ETA + 1))
+);
+
+#define poly_sparse_mul_s16 MLD_NAMESPACE(poly_sparse_mul_s16)
+/*************************************************
+ * Name:        poly_sparse_mul_s16
+ *
+ * Description: Multiplication of a polynomial with coefficients in
+ *              (-2^{MLDSA_D-1}, 2^{MLDSA_D-1}] by a sparse challenge, in
+ *              Z[X]/(X^N + 1) and in normal domain. Output coefficients
+ *              are exact, i.e. not reduced.
+ *
+ * Arguments:   - poly *r: pointer to output polynomial
+ *              - const mld_sparse_challenge *sc: pointer to sparse
+ *                challenge
+ *              - const int16_t a[]: input coefficients
+ **************************************************/
+MLD_INTERNAL_API
+void poly_sparse_mul_s16(poly *r, const mld_sparse_challenge *sc,
+                         const int16_t a[MLDSA_N])
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly)))
+  requires(memory_no_alias(sc, sizeof(mld_sparse_challenge)))
+  requires(memory_no_alias(a, MLDSA_N * sizeof(int16_t)))
+  requires(sc->n <= MLDSA_TAU)
+  requires(array_bound(sc->sign, 0, sc->n, -1, 2))
+  requires(array_abs_bound(a, 0, MLDSA_N, (1 << (MLDSA_D - 1)) + 1))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_abs_bound(r->coeffs, 0, MLDSA_N,
+                          MLDSA_TAU * (1 << (MLDSA_D - 1)) + 1))
+);
+
+#define polyeta_pack MLD_NAMESPACE(polyeta_pack)
+/*************************************************
+ * Name:        polyeta_pack
+ *
+ * Description: Bit-pack polynomial with coefficients in [-MLDSA_ETA,MLDSA_ETA].
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array with at least
+ *                            MLDSA_POLYETA_PACKEDBYTES bytes
+ *              - const poly *a: pointer to input polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void polyeta_pack(uint8_t *r, const poly *a)
+__contract__(
+  requires(memory_no_alias(r, MLDSA_POLYETA_PACKEDBYTES))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_abs_bound(a->coeffs, 0, MLDSA_N, MLDSA_ETA + 1))
+  assigns(memory_slice(r, MLDSA_POLYETA_PACKEDBYTES))
+);
+
+/*
+ * polyeta_unpack produces coefficients in [-MLDSA_ETA,MLDSA_ETA] for
+ * well-formed inputs (i.e., those produced by polyeta_pack).
+ * However, when passed an arbitrary byte array, it may produce smaller values,
+ * i.e, values in [MLD_POLYETA_UNPACK_LOWER_BOUND,MLDSA_ETA]
+ * Even though this should never happen, we use use the bound for arbitrary
+ * inputs in the CBMC proofs.
+ */
+#if MLDSA_ETA == 2
+#define MLD_POLYETA_UNPACK_LOWER_BOUND (-5)
+#elif MLDSA_ETA == 4
+#define MLD_POLYETA_UNPACK_LOWER_BOUND (-11)
+#else
+#error "Invalid value of MLDSA_ETA"
+#endif
+
+#define polyeta_unpack MLD_NAMESPACE(polyeta_unpack)
+/*************************************************
+ * Name:        polyeta_unpack
+ *
+ * Description: Unpack polynomial with coefficients in [-MLDSA_ETA,MLDSA_ETA].
+ *
+ * Arguments:   - poly *r: pointer to output polynomial
+ *              - const uint8_t *a: byte array with bit-packed polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void polyeta_unpack(poly *r, const uint8_t *a)
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly)))
+  requires(memory_no_alias(a, MLDSA_POLYETA_PACKEDBYTES))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_bound(r->coeffs, 0, MLDSA_N, MLD_POLYETA_UNPACK_LOWER_BOUND, MLDSA_ETA + 1))
+);
+
+#define polyz_pack MLD_NAMESPACE(polyz_pack)
+/*************************************************
+ * Name:        polyz_pack
+ *
+ * Description: Bit-pack polynomial with coefficients
+ *              in [-(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1].
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array with at least
+ *                            MLDSA_POLYZ_PACKEDBYTES bytes
+ *              - const poly *a: pointer to input polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void polyz_pack(uint8_t *r, const poly *a)
+__contract__(
+  requires(memory_no_alias(r, MLDSA_POLYZ_PACKEDBYTES))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1))
+  assigns(object_whole(r))
+);
+
+#define polyz_unpack MLD_NAMESPACE(polyz_unpack)
+/*************************************************
+ * Name:        polyz_unpack
+ *
+ * Description: Unpack polynomial z with coefficients
+ *              in [-(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1].
+ *
+ * Arguments:   - poly *r: pointer to output polynomial
+ *              - const uint8_t *a: byte array with bit-packed polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void polyz_unpack(poly *r, const uint8_t *a)
+__contract__(
+  requires(memory_no_alias(r, sizeof(poly)))
+  requires(memory_no_alias(a, MLDSA_POLYZ_PACKEDBYTES))
+  assigns(memory_slice(r, sizeof(poly)))
+  ensures(array_bound(r->coeffs, 0, MLDSA_N, -(MLDSA_GAMMA1 - 1), MLDSA_GAMMA1 + 1))
+);
+
+#define polyw1_pack MLD_NAMESPACE(polyw1_pack)
+/*************************************************
+ * Name:        polyw1_pack
+ *
+ * Description: Bit-pack polynomial w1 with coefficients in [0,15] or [0,43].
+ *              Input coefficients are assumed to be standard representatives.
+ *
+ * Arguments:   - uint8_t *r: pointer to output byte array with at least
+ *                            MLDSA_POLYW1_PACKEDBYTES bytes
+ *              - const poly *a: pointer to input polynomial
+ **************************************************/
+MLD_INTERNAL_API
+void polyw1_pack(uint8_t *r, const poly *a)
+#if MLDSA_MODE == 2
+__contract__(
+  requires(memory_no_alias(r, MLDSA_POLYW1_PACKEDBYTES))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, 0, 44))
+  assigns(object_whole(r)));
+#else  /* MLDSA_MODE == 2 */
+__contract__(
+  requires(memory_no_alias(r, MLDSA_POLYW1_PACKEDBYTES))
+  requires(memory_no_alias(a, sizeof(poly)))
+  requires(array_bound(a->coeffs, 0, MLDSA_N, 0, 16))
+  assigns(object_whole(r)));
+#endif /* MLDSA_MODE != 2 */
+
+#endif /* !MLD_POLY_KL_H */
@@ -3,23 +3,77 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <stdint.h>
+#include <string.h>
 
 #include "common.h"
-#include "poly.h"
+#include "debug.h"
+#include "poly_kl.h"
 #include "polyvec.h"
+#include "stats.h"
 
 void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
                            const uint8_t rho[MLDSA_SEEDBYTES])
 {
   unsigned int i, j;
+  uint8_t seed_ext[8][MLDSA_SEEDBYTES + 2];
 
-  for (i = 0; i < MLDSA_K; ++i)
+  for (j = 0; j < 8; j++)
   {
-    for (j = 0; j < MLDSA_L; ++j)
+    memcpy(seed_ext[j], rho, MLDSA_SEEDBYTES);
+  }
+
+  /* Sample the entries in row-major order, several at a time. Entry (r, s)
+   * is sampled from rho with nonce (r << 8) + s, so this yields the same
+   * matrix as sampling one entry at a time. */
+  i = 0;
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+  /* With an 8-way Keccak backend, take eight entries at a time first --
+   * but only if the backend can run on this host. Otherwise,
+   * poly_uniform_8x() permutes the instances one by one, and its
+   * (de)interleaving is pure overhead over poly_uniform_4x(). */
+  if (mld_keccak_f1600_x8_native_available())
+  {
+    for (; i + 8 <= MLDSA_K * MLDSA_L; i += 8)
     {
-      poly_uniform(&mat[i].vec[j], rho, (i << 8) + j);
+      for (j = 0; j < 8; j++)
+      {
+        seed_ext[j][MLDSA_SEEDBYTES + 0] = (uint8_t)((i + j) % MLDSA_L);
+        seed_ext[j][MLDSA_SEEDBYTES + 1] = (uint8_t)((i + j) / MLDSA_L);
+      }
+      poly_uniform_8x(&mat[(i + 0) / MLDSA_L].vec[(i + 0) % MLDSA_L],
+                      &mat[(i + 1) / MLDSA_L].vec[(i + 1) % MLDSA_L],
+                      &mat[(i + 2) / MLDSA_L].vec[(i + 2) % MLDSA_L],
+                      &mat[(i + 3) / MLDSA_L].vec[(i + 3) % MLDSA_L],
+                      &mat[(i + 4) / MLDSA_L].vec[(i + 4) % MLDSA_L],
+                      &mat[(i + 5) / MLDSA_L].vec[(i + 5) % MLDSA_L],
+                      &mat[(i + 6) / MLDSA_L].vec[(i + 6) % MLDSA_L],
+                      &mat[(i + 7) / MLDSA_L].vec[(i + 7) % MLDSA_L],
+                      (const uint8_t(*)[MLDSA_SEEDBYTES + 2])seed_ext);
     }
   }
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+  for (; i + 4 <= MLDSA_K * MLDSA_L; i += 4)
+  {
+    for (j = 0; j < 4; j++)
+    {
+      seed_ext[j][MLDSA_SEEDBYTES + 0] = (uint8_t)((i + j) % MLDSA_L);
+      seed_ext[j][MLDSA_SEEDBYTES + 1] = (uint8_t)((i + j) / MLDSA_L);
+    }
+    poly_uniform_4x(&mat[(i + 0) / MLDSA_L].vec[(i + 0) % MLDSA_L],
+                    &mat[(i + 1) / MLDSA_L].vec[(i + 1) % MLDSA_L],
+                    &mat[(i + 2) / MLDSA_L].vec[(i + 2) % MLDSA_L],
+                    &mat[(i + 3) / MLDSA_L].vec[(i + 3) % MLDSA_L],
+                    (const uint8_t(*)[MLDSA_SEEDBYTES + 2])seed_ext);
+  }
+
+#if (MLDSA_K * MLDSA_L) % 4 != 0
+  /* Remaining entries */
+  for (; i < MLDSA_K * MLDSA_L; i++)
+  {
+    poly_uniform(&mat[i / MLDSA_L].vec[i % MLDSA_L], rho,
+                 (uint16_t)(((i / MLDSA_L) << 8) + i % MLDSA_L));
+  }
+#endif
 }
 
 void polyvec_matrix_pointwise_montgomery(polyveck *t,
@@ -101,6 +155,16 @@ void polyvecl_ntt(polyvecl *v)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYVEC_NTT)
+  mld_assert_abs_bound(v->vec, MLDSA_L * MLDSA_N, MLDSA_Q);
+  if (mld_polyvec_ntt_native(v->vec[0].coeffs, MLDSA_L) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    MLD_STATS_ADD(ntts, MLDSA_L);
+    mld_assert_abs_bound(v->vec, MLDSA_L * MLDSA_N, MLD_NTT_BOUND);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYVEC_NTT */
   for (i = 0; i < MLDSA_L; ++i)
   __loop__(
     invariant(i <= MLDSA_L)
@@ -120,6 +184,16 @@ void polyvecl_invntt_tomont(polyvecl *v)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYVEC_INTT)
+  mld_assert_abs_bound(v->vec, MLDSA_L * MLDSA_N, MLDSA_Q);
+  if (mld_polyvec_intt_native(v->vec[0].coeffs, MLDSA_L) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    MLD_STATS_ADD(invntts, MLDSA_L);
+    mld_assert_abs_bound(v->vec, MLDSA_L * MLDSA_N, MLDSA_Q);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYVEC_INTT */
   for (i = 0; i < MLDSA_L; ++i)
   __loop__(
     invariant(i <= MLDSA_L)
@@ -152,6 +226,15 @@ void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
   unsigned int i;
   poly t;
 
+#if defined(MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY)
+  if (mld_polyvecl_pointwise_acc_montgomery_native(
+          w->coeffs, u->vec[0].coeffs, v->vec[0].coeffs) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYVECL_POINTWISE_ACC_MONTGOMERY */
+
   poly_pointwise_montgomery(w, &u->vec[0], &v->vec[0]);
   for (i = 1; i < MLDSA_L; ++i)
   {
@@ -280,6 +363,16 @@ void polyveck_ntt(polyveck *v)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYVEC_NTT)
+  mld_assert_abs_bound(v->vec, MLDSA_K * MLDSA_N, MLDSA_Q);
+  if (mld_polyvec_ntt_native(v->vec[0].coeffs, MLDSA_K) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    MLD_STATS_ADD(ntts, MLDSA_K);
+    mld_assert_abs_bound(v->vec, MLDSA_K * MLDSA_N, MLD_NTT_BOUND);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYVEC_NTT */
   for (i = 0; i < MLDSA_K; ++i)
   __loop__(
     invariant(i <= MLDSA_K)
@@ -299,6 +392,16 @@ void polyveck_invntt_tomont(polyveck *v)
 {
   unsigned int i;
 
+#if defined(MLD_USE_NATIVE_POLYVEC_INTT)
+  mld_assert_abs_bound(v->vec, MLDSA_K * MLDSA_N, MLDSA_Q);
+  if (mld_polyvec_intt_native(v->vec[0].coeffs, MLDSA_K) ==
+      MLD_NATIVE_FUNC_SUCCESS)
+  {
+    MLD_STATS_ADD(invntts, MLDSA_K);
+    mld_assert_abs_bound(v->vec, MLDSA_K * MLDSA_N, MLDSA_Q);
+    return;
+  }
+#endif /* MLD_USE_NATIVE_POLYVEC_INTT */
   for (i = 0; i < MLDSA_K; ++i)
   __loop__(
     invariant(i <= MLDSA_K)
@@ -387,34 +490,21 @@ void polyveck_decompose(polyveck *v1, polyveck *v0, const polyveck *v)
   }
 }
 
-unsigned int polyveck_make_hint(polyveck *h, const polyveck *v0,
-                                const polyveck *v1)
+void polyveck_use_hint(polyveck *w, const polyveck *u,
+                       const uint8_t h[MLDSA_POLYVECH_PACKEDBYTES])
 {
-  unsigned int i, s = 0;
+  unsigned int i, k = 0;
 
   for (i = 0; i < MLDSA_K; ++i)
   __loop__(
-    assigns(i, s, object_whole(h))
     invariant(i <= MLDSA_K)
-    invariant(s <= i * MLDSA_N)
-  )
-  {
-    s += poly_make_hint(&h->vec[i], &v0->vec[i], &v1->vec[i]);
-  }
-
-  return s;
-}
-
-void polyveck_use_hint(polyveck *w, const polyveck *u, const polyveck *h)
-{
-  unsigned int i;
-
-  for (i = 0; i < MLDSA_K; ++i)
-  __loop__(
-    invariant(i <= MLDSA_K))
+    invariant(k <= MLDSA_OMEGA)
+    invariant(i == 0 || k == h[MLDSA_OMEGA + i - 1]))
   {
     poly t;
-    poly_use_hint(&t, &u->vec[i], &h->vec[i]);
+    /* The hints for polynomial i are h[k], ..., h[h[MLDSA_OMEGA + i] - 1] */
+    poly_use_hint(&t, &u->vec[i], h + k, h[MLDSA_OMEGA + i] - k);
+    k = h[MLDSA_OMEGA + i];
     /* Full struct assignment from local variables to simplify proof */
     /* TODO: eliminate once CBMC resolves
      * https://github.com/diffblue/cbmc/issues/8617 */
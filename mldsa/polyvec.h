@@ -8,19 +8,22 @@
 #include <stdint.h>
 #include "cbmc.h"
 #include "common.h"
-#include "poly.h"
+#include "poly_kl.h"
 
 /* Vectors of polynomials of length MLDSA_L */
+#define polyvecl MLD_NAMESPACE(polyvecl)
 typedef struct
 {
   poly vec[MLDSA_L];
 } polyvecl;
 
 #define polyvecl_uniform_eta MLD_NAMESPACE(polyvecl_uniform_eta)
+MLD_INTERNAL_API
 void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
                           uint16_t nonce);
 
 #define polyvecl_uniform_gamma1 MLD_NAMESPACE(polyvecl_uniform_gamma1)
+MLD_INTERNAL_API
 void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
                              uint16_t nonce);
 
@@ -34,6 +37,7 @@ void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[MLDSA_CRHBYTES],
  *
  * Arguments:   - poly *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_reduce(polyvecl *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyvecl)))
@@ -55,6 +59,7 @@ __contract__(
  *              - const polyvecl *u: pointer to first summand
  *              - const polyvecl *v: pointer to second summand
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_add(polyvecl *w, const polyvecl *u, const polyvecl *v)
 __contract__(
   requires(memory_no_alias(w, sizeof(polyvecl)))
@@ -76,6 +81,7 @@ __contract__(
  *
  * Arguments:   - polyvecl *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_ntt(polyvecl *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyvecl)))
@@ -94,6 +100,7 @@ __contract__(
  *
  * Arguments:   - polyvecl *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_invntt_tomont(polyvecl *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyvecl)))
@@ -115,6 +122,7 @@ __contract__(
  *              - poly *a: pointer to input polynomial
  *              - polyvecl *v: pointer to input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_pointwise_poly_montgomery(polyvecl *r, const poly *a,
                                         const polyvecl *v)
 __contract__(
@@ -137,6 +145,7 @@ __contract__(
  *              - const polyvecl *u: pointer to first input vector
  *              - const polyvecl *v: pointer to second input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
                                        const polyvecl *v);
 
@@ -154,17 +163,20 @@ void polyvecl_pointwise_acc_montgomery(poly *w, const polyvecl *u,
  * Returns 0 if norm of all polynomials is strictly smaller than B <=
  *(MLDSA_Q-1)/8 and 1 otherwise.
  **************************************************/
+MLD_INTERNAL_API
 int polyvecl_chknorm(const polyvecl *v, int32_t B);
 
 
 
 /* Vectors of polynomials of length MLDSA_K */
+#define polyveck MLD_NAMESPACE(polyveck)
 typedef struct
 {
   poly vec[MLDSA_K];
 } polyveck;
 
 #define polyveck_uniform_eta MLD_NAMESPACE(polyveck_uniform_eta)
+MLD_INTERNAL_API
 void polyveck_uniform_eta(polyveck *v, const uint8_t seed[MLDSA_CRHBYTES],
                           uint16_t nonce);
 
@@ -177,6 +189,7 @@ void polyveck_uniform_eta(polyveck *v, const uint8_t seed[MLDSA_CRHBYTES],
  *
  * Arguments:   - polyveck *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_reduce(polyveck *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyveck)))
@@ -196,6 +209,7 @@ __contract__(
  *
  * Arguments:   - polyveck *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_caddq(polyveck *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyveck)))
@@ -217,6 +231,7 @@ __contract__(
  *              - const polyveck *u: pointer to first summand
  *              - const polyveck *v: pointer to second summand
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_add(polyveck *w, const polyveck *u, const polyveck *v)
 __contract__(
   requires(memory_no_alias(w, sizeof(polyveck)))
@@ -241,6 +256,7 @@ __contract__(
  *              - const polyveck *v: pointer to second input vector to be
  *                                   subtracted from first input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_sub(polyveck *w, const polyveck *u, const polyveck *v)
 __contract__(
   requires(memory_no_alias(w, sizeof(polyveck)))
@@ -263,6 +279,7 @@ __contract__(
  *
  * Arguments:   - polyveck *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_shiftl(polyveck *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyveck)))
@@ -279,6 +296,7 @@ __contract__(
  *
  * Arguments:   - polyveck *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_ntt(polyveck *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyveck)))
@@ -297,6 +315,7 @@ __contract__(
  *
  * Arguments:   - polyveck *v: pointer to input/output vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_invntt_tomont(polyveck *v)
 __contract__(
   requires(memory_no_alias(v, sizeof(polyveck)))
@@ -318,6 +337,7 @@ __contract__(
  *              - poly *a: pointer to input polynomial
  *              - polyveck *v: pointer to input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_pointwise_poly_montgomery(polyveck *r, const poly *a,
                                         const polyveck *v)
 __contract__(
@@ -340,6 +360,7 @@ __contract__(
  * Returns 0 if norm of all polynomials are strictly smaller than B <=
  *(MLDSA_Q-1)/8 and 1 otherwise.
  **************************************************/
+MLD_INTERNAL_API
 int polyveck_chknorm(const polyveck *v, int32_t B);
 
 #define polyveck_power2round MLD_NAMESPACE(polyveck_power2round)
@@ -357,6 +378,7 @@ int polyveck_chknorm(const polyveck *v, int32_t B);
  *                              coefficients a0
  *              - const polyveck *v: pointer to input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_power2round(polyveck *v1, polyveck *v0, const polyveck *v)
 __contract__(
   requires(memory_no_alias(v1, sizeof(polyveck)))
@@ -385,6 +407,7 @@ __contract__(
  *                              coefficients a0
  *              - const polyveck *v: pointer to input vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_decompose(polyveck *v1, polyveck *v0, const polyveck *v)
 __contract__(
   requires(memory_no_alias(v1,  sizeof(polyveck)))
@@ -399,28 +422,6 @@ __contract__(
                  array_abs_bound(v0->vec[k1].coeffs, 0, MLDSA_N, MLDSA_GAMMA2+1)))
 );
 
-#define polyveck_make_hint MLD_NAMESPACE(polyveck_make_hint)
-/*************************************************
- * Name:        polyveck_make_hint
- *
- * Description: Compute hint vector.
- *
- * Arguments:   - polyveck *h: pointer to output vector
- *              - const polyveck *v0: pointer to low part of input vector
- *              - const polyveck *v1: pointer to high part of input vector
- *
- * Returns number of 1 bits.
- **************************************************/
-unsigned int polyveck_make_hint(polyveck *h, const polyveck *v0,
-                                const polyveck *v1)
-__contract__(
-  requires(memory_no_alias(h,  sizeof(polyveck)))
-  requires(memory_no_alias(v0, sizeof(polyveck)))
-  requires(memory_no_alias(v1, sizeof(polyveck)))
-  assigns(object_whole(h))
-  ensures(return_value <= MLDSA_N * MLDSA_K)
-);
-
 #define polyveck_use_hint MLD_NAMESPACE(polyveck_use_hint)
 /*************************************************
  * Name:        polyveck_use_hint
@@ -430,17 +431,20 @@ __contract__(
  * Arguments:   - polyveck *w: pointer to output vector of polynomials with
  *                             corrected high bits
  *              - const polyveck *u: pointer to input vector
- *              - const polyveck *h: pointer to input hint vector
+ *              - const uint8_t h[]: hints in packed form, as output by
+ *                unpack_sig
  **************************************************/
-void polyveck_use_hint(polyveck *w, const polyveck *v, const polyveck *h)
+MLD_INTERNAL_API
+void polyveck_use_hint(polyveck *w, const polyveck *v,
+                       const uint8_t h[MLDSA_POLYVECH_PACKEDBYTES])
 __contract__(
   requires(memory_no_alias(w,  sizeof(polyveck)))
   requires(memory_no_alias(v, sizeof(polyveck)))
-  requires(memory_no_alias(h, sizeof(polyveck)))
+  requires(memory_no_alias(h, MLDSA_POLYVECH_PACKEDBYTES))
   requires(forall(k0, 0, MLDSA_K,
     array_bound(v->vec[k0].coeffs, 0, MLDSA_N, 0, MLDSA_Q)))
-  requires(forall(k1, 0, MLDSA_K,
-    array_bound(h->vec[k1].coeffs, 0, MLDSA_N, 0, 2)))
+  requires(forall(k1, 0, MLDSA_K, h[MLDSA_OMEGA + k1] <= MLDSA_OMEGA))
+  requires(forall(k2, 1, MLDSA_K, h[MLDSA_OMEGA + k2 - 1] <= h[MLDSA_OMEGA + k2]))
   assigns(memory_slice(w, sizeof(polyveck)))
   requires(forall(k2, 0, MLDSA_K,
     array_bound(w->vec[k2].coeffs, 0, MLDSA_N, 0, (MLDSA_Q-1)/(2*MLDSA_GAMMA2))))
@@ -458,6 +462,7 @@ __contract__(
  *                            MLDSA_K* MLDSA_POLYW1_PACKEDBYTES bytes
  *              - const polyveck *a: pointer to input polynomial vector
  **************************************************/
+MLD_INTERNAL_API
 void polyveck_pack_w1(uint8_t r[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES],
                       const polyveck *w1)
 #if MLDSA_MODE == 2
@@ -478,6 +483,7 @@ __contract__(
 
 
 #define polyveck_pack_eta MLD_NAMESPACE(polyveck_pack_eta)
+MLD_INTERNAL_API
 void polyveck_pack_eta(uint8_t r[MLDSA_K * MLDSA_POLYETA_PACKEDBYTES],
                        const polyveck *p)
 __contract__(
@@ -489,6 +495,7 @@ __contract__(
 );
 
 #define polyvecl_pack_eta MLD_NAMESPACE(polyvecl_pack_eta)
+MLD_INTERNAL_API
 void polyvecl_pack_eta(uint8_t r[MLDSA_L * MLDSA_POLYETA_PACKEDBYTES],
                        const polyvecl *p)
 __contract__(
@@ -500,6 +507,7 @@ __contract__(
 );
 
 #define polyvecl_pack_z MLD_NAMESPACE(polyvecl_pack_z)
+MLD_INTERNAL_API
 void polyvecl_pack_z(uint8_t r[MLDSA_L * MLDSA_POLYZ_PACKEDBYTES],
                      const polyvecl *p)
 __contract__(
@@ -511,6 +519,7 @@ __contract__(
 );
 
 #define polyveck_pack_t0 MLD_NAMESPACE(polyveck_pack_t0)
+MLD_INTERNAL_API
 void polyveck_pack_t0(uint8_t r[MLDSA_K * MLDSA_POLYT0_PACKEDBYTES],
                       const polyveck *p)
 __contract__(
@@ -522,6 +531,7 @@ __contract__(
 );
 
 #define polyvecl_unpack_eta MLD_NAMESPACE(polyvecl_unpack_eta)
+MLD_INTERNAL_API
 void polyvecl_unpack_eta(polyvecl *p,
                          const uint8_t r[MLDSA_L * MLDSA_POLYETA_PACKEDBYTES])
 __contract__(
@@ -533,6 +543,7 @@ __contract__(
 );
 
 #define polyvecl_unpack_z MLD_NAMESPACE(polyvecl_unpack_z)
+MLD_INTERNAL_API
 void polyvecl_unpack_z(polyvecl *z,
                        const uint8_t r[MLDSA_L * MLDSA_POLYZ_PACKEDBYTES])
 __contract__(
@@ -544,6 +555,7 @@ __contract__(
 );
 
 #define polyveck_unpack_eta MLD_NAMESPACE(polyveck_unpack_eta)
+MLD_INTERNAL_API
 void polyveck_unpack_eta(polyveck *p,
                          const uint8_t r[MLDSA_K * MLDSA_POLYETA_PACKEDBYTES])
 __contract__(
@@ -555,6 +567,7 @@ __contract__(
 );
 
 #define polyveck_unpack_t0 MLD_NAMESPACE(polyveck_unpack_t0)
+MLD_INTERNAL_API
 void polyveck_unpack_t0(polyveck *p,
                         const uint8_t r[MLDSA_K * MLDSA_POLYT0_PACKEDBYTES])
 __contract__(
@@ -576,11 +589,13 @@ __contract__(
  * Arguments:   - polyvecl mat[MLDSA_K]: output matrix
  *              - const uint8_t rho[]: byte array containing seed rho
  **************************************************/
+MLD_INTERNAL_API
 void polyvec_matrix_expand(polyvecl mat[MLDSA_K],
                            const uint8_t rho[MLDSA_SEEDBYTES]);
 
 #define polyvec_matrix_pointwise_montgomery \
   MLD_NAMESPACE(polyvec_matrix_pointwise_montgomery)
+MLD_INTERNAL_API
 void polyvec_matrix_pointwise_montgomery(polyveck *t,
                                          const polyvecl mat[MLDSA_K],
                                          const polyvecl *v);
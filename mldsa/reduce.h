@@ -14,7 +14,36 @@
 #define REDUCE_RANGE_MAX 6283009
 #define MONTGOMERY_REDUCE_DOMAIN_MAX ((int64_t)INT32_MIN * INT32_MIN)
 
-#define montgomery_reduce MLD_NAMESPACE(montgomery_reduce)
+#define mld_cast_uint32_to_int32 MLD_NAMESPACE_SHARED(cast_uint32_to_int32)
+/*************************************************
+ * Name:        mld_cast_uint32_to_int32
+ *
+ * Description: Cast uint32 value to int32
+ *
+ * Returns:
+ *   input x in     0 .. 2^31-1: returns value unchanged
+ *   input x in  2^31 .. 2^32-1: returns (x - 2^32)
+ **************************************************/
+#ifdef CBMC
+#pragma CPROVER check push
+#pragma CPROVER check disable "conversion"
+#endif
+static MLD_INLINE int32_t mld_cast_uint32_to_int32(uint32_t x)
+{
+  /*
+   * PORTABILITY: This relies on uint32_t -> int32_t
+   * being implemented as the inverse of int32_t -> uint32_t,
+   * which is implementation-defined (C99 6.3.1.3 (3))
+   * CBMC (correctly) fails to prove this conversion is OK,
+   * so we have to suppress that check here
+   */
+  return (int32_t)x;
+}
+#ifdef CBMC
+#pragma CPROVER check pop
+#endif
+
+#define montgomery_reduce MLD_NAMESPACE_SHARED(montgomery_reduce)
 /*************************************************
  * Name:        montgomery_reduce
  *
@@ -29,12 +58,35 @@
  *
  * Returns r.
  **************************************************/
-int32_t montgomery_reduce(int64_t a)
+static MLD_INLINE int32_t montgomery_reduce(int64_t a)
 __contract__(
   requires(a >= -MONTGOMERY_REDUCE_DOMAIN_MAX && a <= MONTGOMERY_REDUCE_DOMAIN_MAX)
-);
+)
+{
+  /* check-magic: 58728449 == unsigned_mod(pow(MLDSA_Q, -1, 2^32), 2^32) */
+  const uint64_t QINV = 58728449;
+
+  /*  Compute a*q^{-1} mod 2^32 in unsigned representatives */
+  const uint32_t a_reduced = a & UINT32_MAX;
+  const uint32_t a_inverted = (a_reduced * QINV) & UINT32_MAX;
 
-#define reduce32 MLD_NAMESPACE(reduce32)
+  /* Lift to signed canonical representative mod 2^16. */
+  const int32_t t = mld_cast_uint32_to_int32(a_inverted);
+
+  int64_t r;
+
+  r = a - ((int64_t)t * MLDSA_Q);
+
+  /*
+   * PORTABILITY: Right-shift on a signed integer is, strictly-speaking,
+   * implementation-defined for negative left argument. Here,
+   * we assume it's sign-preserving "arithmetic" shift right. (C99 6.5.7 (5))
+   */
+  r = r >> 32;
+  return (int32_t)r;
+}
+
+#define reduce32 MLD_NAMESPACE_SHARED(reduce32)
 /*************************************************
  * Name:        reduce32
  *
@@ -46,14 +98,22 @@ __contract__(
  *
  * Returns r.
  **************************************************/
-int32_t reduce32(int32_t a)
+static MLD_INLINE int32_t reduce32(int32_t a)
 __contract__(
   requires(a <= REDUCE_DOMAIN_MAX)
   ensures(return_value >= -REDUCE_RANGE_MAX)
   ensures(return_value <   REDUCE_RANGE_MAX)
-);
+)
+{
+  int32_t t;
+
+  t = (a + (1 << 22)) >> 23;
+  t = a - t * MLDSA_Q;
+  cassert((t - a) % MLDSA_Q == 0);
+  return t;
+}
 
-#define caddq MLD_NAMESPACE(caddq)
+#define caddq MLD_NAMESPACE_SHARED(caddq)
 /*************************************************
  * Name:        caddq
  *
@@ -63,14 +123,17 @@ __contract__(
  *
  * Returns r.
  **************************************************/
-int32_t caddq(int32_t a)
+static MLD_INLINE int32_t caddq(int32_t a)
 __contract__(
   requires(a > -MLDSA_Q)
   requires(a < MLDSA_Q)
   ensures(return_value >= 0)
   ensures(return_value < MLDSA_Q)
   ensures(return_value == (a >= 0) ? a : (a + MLDSA_Q))
-);
-
+)
+{
+  a += (a >> 31) & MLDSA_Q;
+  return a;
+}
 
 #endif /* !MLD_REDUCE_H */
@@ -26,7 +26,7 @@
  * Reference: In the reference implementation, a1 is passed as a
  * return value instead.
  **************************************************/
-void power2round(int32_t *a0, int32_t *a1, int32_t a)
+static MLD_INLINE void power2round(int32_t *a0, int32_t *a1, int32_t a)
 __contract__(
   requires(memory_no_alias(a0, sizeof(int32_t)))
   requires(memory_no_alias(a1, sizeof(int32_t)))
@@ -36,7 +36,12 @@ __contract__(
   ensures(*a0 > -(MLD_2_POW_D/2) && *a0 <= (MLD_2_POW_D/2))
   ensures(*a1 >= 0 && *a1 <= (MLDSA_Q - 1) / MLD_2_POW_D)
   ensures((*a1 * MLD_2_POW_D + *a0 - a) % MLDSA_Q == 0)
-);
+)
+{
+  *a1 = (a + (1 << (MLDSA_D - 1)) - 1) >> MLDSA_D;
+  *a0 = a - (*a1 << MLDSA_D);
+}
+
 
 
 #define decompose MLD_NAMESPACE(decompose)
@@ -56,7 +61,7 @@ __contract__(
  *
  * Reference: a1 is passed as a return value instead
  **************************************************/
-void decompose(int32_t *a0, int32_t *a1, int32_t a)
+static MLD_INLINE void decompose(int32_t *a0, int32_t *a1, int32_t a)
 __contract__(
   requires(memory_no_alias(a0, sizeof(int32_t)))
   requires(memory_no_alias(a1, sizeof(int32_t)))
@@ -68,7 +73,30 @@ __contract__(
   ensures(*a0 >= -MLDSA_GAMMA2  && *a0 <= MLDSA_GAMMA2)
   ensures(*a1 >= 0 && *a1 < (MLDSA_Q-1)/(2*MLDSA_GAMMA2))
   ensures((*a1 * 2 * MLDSA_GAMMA2 + *a0 - a) % MLDSA_Q == 0)
-);
+)
+{
+  *a1 = (a + 127) >> 7;
+  /* We know a >= 0 and a < MLDSA_Q, so... */
+  cassert(*a1 >= 0 && *a1 <= 65472);
+
+#if MLDSA_MODE == 2
+  *a1 = (*a1 * 11275 + (1 << 23)) >> 24;
+  cassert(*a1 >= 0 && *a1 <= 44);
+
+  *a1 ^= ((43 - *a1) >> 31) & *a1;
+  cassert(*a1 >= 0 && *a1 <= 43);
+#else /* MLDSA_MODE == 2 */
+  *a1 = (*a1 * 1025 + (1 << 21)) >> 22;
+  cassert(*a1 >= 0 && *a1 <= 16);
+
+  *a1 &= 15;
+  cassert(*a1 >= 0 && *a1 <= 15);
+
+#endif /* MLDSA_MODE != 2 */
+
+  *a0 = a - *a1 * 2 * MLDSA_GAMMA2;
+  *a0 -= (((MLDSA_Q - 1) / 2 - *a0) >> 31) & MLDSA_Q;
+}
 
 #define make_hint MLD_NAMESPACE(make_hint)
 /*************************************************
@@ -82,10 +110,16 @@ __contract__(
  *
  * Returns 1 if overflow, 0 otherwise
  **************************************************/
-unsigned int make_hint(int32_t a0, int32_t a1)
+static MLD_INLINE unsigned int make_hint(int32_t a0, int32_t a1)
 __contract__(
   ensures(return_value >= 0 && return_value <= 1)
-);
+)
+{
+  /* Bitwise rather than short-circuit operators, so that compilers can
+   * vectorize loops over this function */
+  return (unsigned int)((a0 > MLDSA_GAMMA2) | (a0 < -MLDSA_GAMMA2) |
+                        ((a0 == -MLDSA_GAMMA2) & (a1 != 0)));
+}
 
 #define use_hint MLD_NAMESPACE(use_hint)
 /*************************************************
@@ -98,11 +132,40 @@ __contract__(
  *
  * Returns corrected high bits.
  **************************************************/
-int32_t use_hint(int32_t a, unsigned int hint)
+static MLD_INLINE int32_t use_hint(int32_t a, unsigned int hint)
 __contract__(
   requires(hint >= 0 && hint <= 1)
   requires(a >= 0 && a < MLDSA_Q)
   ensures(return_value >= 0 && return_value < (MLDSA_Q-1)/(2*MLDSA_GAMMA2))
-);
+)
+{
+  int32_t a0, a1;
+
+  decompose(&a0, &a1, a);
+  if (hint == 0)
+  {
+    return a1;
+  }
+
+#if MLDSA_MODE == 2
+  if (a0 > 0)
+  {
+    return (a1 == 43) ? 0 : a1 + 1;
+  }
+  else
+  {
+    return (a1 == 0) ? 43 : a1 - 1;
+  }
+#else  /* MLDSA_MODE == 2 */
+  if (a0 > 0)
+  {
+    return (a1 + 1) & 15;
+  }
+  else
+  {
+    return (a1 - 1) & 15;
+  }
+#endif /* MLDSA_MODE != 2 */
+}
 
 #endif /* !MLD_ROUNDING_H */
@@ -6,23 +6,62 @@
 #include <string.h>
 
 #include "cbmc.h"
+#include "expanded.h"
 #include "fips202/fips202.h"
+#include "fips202/fips202x4.h"
 #include "packing.h"
-#include "poly.h"
+#include "poly_kl.h"
 #include "polyvec.h"
 #include "randombytes.h"
 #include "sign.h"
+#include "stats.h"
 #include "symmetric.h"
+#include "trace.h"
+#include "verify_cache.h"
 
-int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
-                                 const uint8_t seed[MLDSA_SEEDBYTES])
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mld_keypair_expand MLD_NAMESPACE(keypair_expand)
+#define mld_compute_mu MLD_NAMESPACE(compute_mu)
+#define mld_compute_rhoprime MLD_NAMESPACE(compute_rhoprime)
+#define mld_sign_expanded MLD_NAMESPACE(sign_expanded)
+#define mld_keypair_x4 MLD_NAMESPACE(keypair_x4)
+#define mld_verify_expand_pk MLD_NAMESPACE(verify_expand_pk)
+#define mld_verify_unpack MLD_NAMESPACE(verify_unpack)
+#define mld_verify_core MLD_NAMESPACE(verify_core)
+/* End of static namespacing */
+
+/*************************************************
+ * Name:        mld_keypair_expand
+ *
+ * Description: Expands the seed xi into rho, K, the matrix A, the secret
+ *              vectors s1 and s2 and t = A*s1 + s2. This is the part of
+ *              ML-DSA.KeyGen_internal shared by key generation and
+ *              signing from a seed.
+ *
+ * Arguments:   - uint8_t rho[]: output public seed (MLDSA_SEEDBYTES bytes)
+ *              - uint8_t key[]: output signing seed K (MLDSA_SEEDBYTES
+ *                bytes)
+ *              - polyvecl mat[]: output matrix A in NTT domain
+ *              - polyvecl *s1: output secret vector s1
+ *              - polyvecl *s1hat: output secret vector s1 in NTT domain
+ *              - polyveck *s2: output secret vector s2
+ *              - polyveck *t: output vector t = A*s1 + s2
+ *              - const uint8_t seed[]: input seed xi (MLDSA_SEEDBYTES bytes)
+ **************************************************/
+static void mld_keypair_expand(uint8_t rho[MLDSA_SEEDBYTES],
+                               uint8_t key[MLDSA_SEEDBYTES],
+                               polyvecl mat[MLDSA_K], polyvecl *s1,
+                               polyvecl *s1hat, polyveck *s2, polyveck *t,
+                               const uint8_t seed[MLDSA_SEEDBYTES])
 {
   uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES];
-  uint8_t tr[MLDSA_TRBYTES];
-  const uint8_t *rho, *rhoprime, *key;
-  polyvecl mat[MLDSA_K];
-  polyvecl s1, s1hat;
-  polyveck s2, t1, t0;
+  const uint8_t *rhoprime;
+  MLD_TRACE_DECLARE
+
+  MLD_TRACE_START();
 
   /* Get randomness for rho, rhoprime and key */
   memcpy(seedbuf, seed, MLDSA_SEEDBYTES);
@@ -30,35 +69,56 @@ int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
   seedbuf[MLDSA_SEEDBYTES + 1] = MLDSA_L;
   shake256(seedbuf, 2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES, seedbuf,
            MLDSA_SEEDBYTES + 2);
-  rho = seedbuf;
-  rhoprime = rho + MLDSA_SEEDBYTES;
-  key = rhoprime + MLDSA_CRHBYTES;
+  memcpy(rho, seedbuf, MLDSA_SEEDBYTES);
+  rhoprime = seedbuf + MLDSA_SEEDBYTES;
+  memcpy(key, rhoprime + MLDSA_CRHBYTES, MLDSA_SEEDBYTES);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_EXPAND_SEED);
 
   /* Expand matrix */
   polyvec_matrix_expand(mat, rho);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_EXPAND_MATRIX);
 
   /* Sample short vectors s1 and s2 */
-  polyvecl_uniform_eta(&s1, rhoprime, 0);
-  polyveck_uniform_eta(&s2, rhoprime, MLDSA_L);
+  polyvecl_uniform_eta(s1, rhoprime, 0);
+  polyveck_uniform_eta(s2, rhoprime, MLDSA_L);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_SAMPLE_S);
 
   /* Matrix-vector multiplication */
-  s1hat = s1;
-  polyvecl_ntt(&s1hat);
-  polyvec_matrix_pointwise_montgomery(&t1, mat, &s1hat);
-  polyveck_reduce(&t1);
-  polyveck_invntt_tomont(&t1);
+  *s1hat = *s1;
+  polyvecl_ntt(s1hat);
+  polyvec_matrix_pointwise_montgomery(t, mat, s1hat);
+  polyveck_reduce(t);
+  polyveck_invntt_tomont(t);
 
   /* Add error vector s2 */
-  polyveck_add(&t1, &t1, &s2);
+  polyveck_add(t, t, s2);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_MATVEC);
+}
+
+int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
+                                 const uint8_t seed[MLDSA_SEEDBYTES])
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t tr[MLDSA_TRBYTES];
+  polyvecl mat[MLDSA_K];
+  polyvecl s1, s1hat;
+  polyveck s2, t1, t0;
+  MLD_TRACE_DECLARE
+
+  mld_keypair_expand(rho, key, mat, &s1, &s1hat, &s2, &t1, seed);
+  MLD_TRACE_START();
 
   /* Extract t1 and write public key */
   polyveck_caddq(&t1);
   polyveck_power2round(&t1, &t0, &t1);
   pack_pk(pk, rho, &t1);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_PACK_PK);
 
   /* Compute H(rho, t1) and write secret key */
   shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
   pack_sk(sk, rho, tr, key, &t0, &s1, &s2);
+  MLD_TRACE_STAGE(MLD_TRACE_KEYPAIR_PACK_SK);
   return 0;
 }
 
@@ -69,31 +129,240 @@ int crypto_sign_keypair(uint8_t *pk, uint8_t *sk)
   return crypto_sign_keypair_internal(pk, sk, seed);
 }
 
-int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
-                                   const uint8_t *m, size_t mlen,
-                                   const uint8_t *pre, size_t prelen,
-                                   const uint8_t rnd[MLDSA_RNDBYTES],
-                                   const uint8_t *sk, int externalmu)
+/*************************************************
+ * Name:        mld_keypair_x4
+ *
+ * Description: Computes four key pairs, each as crypto_sign_keypair_internal
+ *              would. Every SHAKE computation is shared across the four
+ *              keys, so that a native multi-lane Keccak-f1600 processes
+ *              them in parallel: the seed expansion, the sampling of s1
+ *              and s2 and the hash tr = H(pk) go through mld_shake256x4,
+ *              and the matrix entries through poly_uniform_4x.
+ *
+ *              With a native 8-way Keccak, two consecutive entries of all
+ *              four matrices are sampled per poly_uniform_8x call instead,
+ *              filling all eight lanes. Each entry is consumed by the
+ *              matrix-vector product as soon as it is sampled, so that
+ *              the matrices are never held in memory.
+ *
+ * Arguments:   - uint8_t *pk: output public keys (4 * CRYPTO_PUBLICKEYBYTES
+ *                bytes)
+ *              - uint8_t *sk: output secret keys (4 * CRYPTO_SECRETKEYBYTES
+ *                bytes)
+ *              - const uint8_t *seeds: input seeds (4 * MLDSA_SEEDBYTES
+ *                bytes)
+ **************************************************/
+static void mld_keypair_x4(uint8_t *pk, uint8_t *sk, const uint8_t *seeds)
 {
-  unsigned int n;
-  uint8_t seedbuf[2 * MLDSA_SEEDBYTES + MLDSA_TRBYTES + 2 * MLDSA_CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
-  uint16_t nonce = 0;
-  polyvecl mat[MLDSA_K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
-  poly cp;
-  keccak_state state;
+  uint8_t in[4][MLDSA_SEEDBYTES + 2];
+  uint8_t seedbuf[4][2 * MLDSA_SEEDBYTES + MLDSA_CRHBYTES];
+  uint8_t rho[8][MLDSA_SEEDBYTES + 2];
+  uint8_t rhoprime[4][MLDSA_CRHBYTES];
+  uint8_t key[4][MLDSA_SEEDBYTES];
+  uint8_t s_packed[4][(MLDSA_L + MLDSA_K) * MLDSA_POLYETA_PACKEDBYTES];
+  uint8_t tr[4][MLDSA_TRBYTES];
+  polyvecl s1hat[4];
+  polyveck t[4];
+  polyvecl s1;
+  polyveck s2, t0;
+  poly a[8], tmp;
+  unsigned int e, i, j, k, step = 1;
 
-  rho = seedbuf;
-  tr = rho + MLDSA_SEEDBYTES;
-  key = tr + MLDSA_TRBYTES;
-  mu = key + MLDSA_SEEDBYTES;
-  rhoprime = mu + MLDSA_CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+  /* Get randomness for rho, rhoprime and key */
+  for (k = 0; k < 4; k++)
+  {
+    memcpy(in[k], seeds + k * MLDSA_SEEDBYTES, MLDSA_SEEDBYTES);
+    in[k][MLDSA_SEEDBYTES + 0] = MLDSA_K;
+    in[k][MLDSA_SEEDBYTES + 1] = MLDSA_L;
+  }
+  mld_shake256x4(seedbuf[0], seedbuf[1], seedbuf[2], seedbuf[3],
+                 sizeof(seedbuf[0]), in[0], in[1], in[2], in[3],
+                 MLDSA_SEEDBYTES + 2);
+  for (k = 0; k < 4; k++)
+  {
+    memcpy(rho[k], seedbuf[k], MLDSA_SEEDBYTES);
+    memcpy(rho[k + 4], seedbuf[k], MLDSA_SEEDBYTES);
+    memcpy(rhoprime[k], seedbuf[k] + MLDSA_SEEDBYTES, MLDSA_CRHBYTES);
+    memcpy(key[k], seedbuf[k] + MLDSA_SEEDBYTES + MLDSA_CRHBYTES,
+           MLDSA_SEEDBYTES);
+  }
+
+  /* Sample short vectors s1 and s2 one nonce at a time, and keep them
+   * packed until the secret key is written */
+  for (i = 0; i < MLDSA_L + MLDSA_K; i++)
+  {
+    poly_uniform_eta_4x(&a[0], &a[1], &a[2], &a[3],
+                        (const uint8_t(*)[MLDSA_CRHBYTES])rhoprime,
+                        (uint16_t)i);
+    for (k = 0; k < 4; k++)
+    {
+      polyeta_pack(s_packed[k] + i * MLDSA_POLYETA_PACKEDBYTES, &a[k]);
+      if (i < MLDSA_L)
+      {
+        s1hat[k].vec[i] = a[k];
+        poly_ntt(&s1hat[k].vec[i]);
+      }
+    }
+  }
+
+#if defined(MLD_USE_FIPS202_X8_NATIVE)
+#if (MLDSA_K * MLDSA_L) % 2 != 0
+#error "mld_keypair_x4 assumes an even number of matrix entries"
+#endif
+  if (mld_keccak_f1600_x8_native_available())
+  {
+    step = 2;
+  }
+#endif /* MLD_USE_FIPS202_X8_NATIVE */
+
+  /* Matrix-vector multiplication, accumulating in the same order as
+   * polyvecl_pointwise_acc_montgomery(). The entries are visited in
+   * row-major order e = i * MLDSA_L + j; lane k holds entry e + k / 4 of
+   * key k % 4. */
+  for (e = 0; e < MLDSA_K * MLDSA_L; e += step)
+  {
+    for (k = 0; k < 4 * step; k++)
+    {
+      rho[k][MLDSA_SEEDBYTES + 0] = (uint8_t)((e + k / 4) % MLDSA_L);
+      rho[k][MLDSA_SEEDBYTES + 1] = (uint8_t)((e + k / 4) / MLDSA_L);
+    }
+    if (step == 2)
+    {
+      poly_uniform_8x(&a[0], &a[1], &a[2], &a[3], &a[4], &a[5], &a[6], &a[7],
+                      (const uint8_t(*)[MLDSA_SEEDBYTES + 2])rho);
+    }
+    else
+    {
+      poly_uniform_4x(&a[0], &a[1], &a[2], &a[3],
+                      (const uint8_t(*)[MLDSA_SEEDBYTES + 2])rho);
+    }
+
+    for (k = 0; k < 4 * step; k++)
+    {
+      i = (e + k / 4) / MLDSA_L;
+      j = (e + k / 4) % MLDSA_L;
+      if (j == 0)
+      {
+        poly_pointwise_montgomery(&t[k % 4].vec[i], &a[k],
+                                  &s1hat[k % 4].vec[0]);
+      }
+      else
+      {
+        poly_pointwise_montgomery(&tmp, &a[k], &s1hat[k % 4].vec[j]);
+        poly_add(&t[k % 4].vec[i], &t[k % 4].vec[i], &tmp);
+      }
+    }
+  }
+
+  for (k = 0; k < 4; k++)
+  {
+    uint8_t *pk_k = pk + k * CRYPTO_PUBLICKEYBYTES;
+    uint8_t *sk_k = sk + k * CRYPTO_SECRETKEYBYTES;
+
+    polyvecl_unpack_eta(&s1, s_packed[k]);
+    polyveck_unpack_eta(&s2, s_packed[k] + MLDSA_L * MLDSA_POLYETA_PACKEDBYTES);
+
+    polyveck_reduce(&t[k]);
+    polyveck_invntt_tomont(&t[k]);
+
+    /* Add error vector s2 */
+    polyveck_add(&t[k], &t[k], &s2);
+
+    /* Extract t1 and write public key */
+    polyveck_caddq(&t[k]);
+    polyveck_power2round(&t[k], &t0, &t[k]);
+    pack_pk(pk_k, rho[k], &t[k]);
+
+    /* Write secret key; tr is filled in below, once all four public
+     * keys are known */
+    memset(tr[k], 0, MLDSA_TRBYTES);
+    pack_sk(sk_k, rho[k], tr[k], key[k], &t0, &s1, &s2);
+  }
+
+  /* Compute H(rho, t1) for all four keys and insert it into the secret
+   * keys, which store tr after rho and key */
+  mld_shake256x4(tr[0], tr[1], tr[2], tr[3], MLDSA_TRBYTES, pk,
+                 pk + CRYPTO_PUBLICKEYBYTES, pk + 2 * CRYPTO_PUBLICKEYBYTES,
+                 pk + 3 * CRYPTO_PUBLICKEYBYTES, CRYPTO_PUBLICKEYBYTES);
+  for (k = 0; k < 4; k++)
+  {
+    memcpy(sk + k * CRYPTO_SECRETKEYBYTES + 2 * MLDSA_SEEDBYTES, tr[k],
+           MLDSA_TRBYTES);
+  }
+}
+
+int crypto_sign_keypair_batch_internal(uint8_t *pk, uint8_t *sk,
+                                       const uint8_t *seeds, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+  {
+    mld_keypair_x4(pk + i * CRYPTO_PUBLICKEYBYTES,
+                   sk + i * CRYPTO_SECRETKEYBYTES, seeds + i * MLDSA_SEEDBYTES);
+  }
+
+  for (; i < n; i++)
+  {
+    crypto_sign_keypair_internal(pk + i * CRYPTO_PUBLICKEYBYTES,
+                                 sk + i * CRYPTO_SECRETKEYBYTES,
+                                 seeds + i * MLDSA_SEEDBYTES);
+  }
+  return 0;
+}
+
+int crypto_sign_keypair_batch(uint8_t *pk, uint8_t *sk, size_t n)
+{
+  uint8_t seeds[4 * MLDSA_SEEDBYTES];
+  size_t i, m;
+
+  for (i = 0; i < n; i += m)
+  {
+    m = (n - i < 4) ? n - i : 4;
+    randombytes(seeds, m * MLDSA_SEEDBYTES);
+    crypto_sign_keypair_batch_internal(pk + i * CRYPTO_PUBLICKEYBYTES,
+                                       sk + i * CRYPTO_SECRETKEYBYTES, seeds,
+                                       m);
+  }
+  return 0;
+}
+
+int crypto_sign_pk_from_seed(uint8_t *pk, const uint8_t seed[MLDSA_SEEDBYTES])
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  polyvecl mat[MLDSA_K];
+  polyvecl s1, s1hat;
+  polyveck s2, t1, t0;
+
+  mld_keypair_expand(rho, key, mat, &s1, &s1hat, &s2, &t1, seed);
+  polyveck_caddq(&t1);
+  polyveck_power2round(&t1, &t0, &t1);
+  pack_pk(pk, rho, &t1);
+  return 0;
+}
+
+int crypto_sign_keypair_seed(uint8_t *pk, uint8_t seed[MLDSA_SEEDBYTES])
+{
+  randombytes(seed, MLDSA_SEEDBYTES);
+  return crypto_sign_pk_from_seed(pk, seed);
+}
+
+/*************************************************
+ * Name:        mld_compute_mu
+ *
+ * Description: Computes mu = CRH(tr, pre, msg), or copies mu from m
+ *              if externalmu is set.
+ **************************************************/
+static void mld_compute_mu(uint8_t mu[MLDSA_CRHBYTES],
+                           const uint8_t tr[MLDSA_TRBYTES], const uint8_t *pre,
+                           size_t prelen, const uint8_t *m, size_t mlen,
+                           int externalmu)
+{
+  keccak_state state;
 
   if (!externalmu)
   {
-    /* Compute mu = CRH(tr, pre, msg) */
     shake256_init(&state);
     shake256_absorb(&state, tr, MLDSA_TRBYTES);
     shake256_absorb(&state, pre, prelen);
@@ -106,24 +375,67 @@ int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
     /* mu has been provided directly */
     memcpy(mu, m, MLDSA_CRHBYTES);
   }
+}
+
+/*************************************************
+ * Name:        mld_compute_rhoprime
+ *
+ * Description: Computes rhoprime = CRH(key, rnd, mu).
+ **************************************************/
+static void mld_compute_rhoprime(uint8_t rhoprime[MLDSA_CRHBYTES],
+                                 const uint8_t key[MLDSA_SEEDBYTES],
+                                 const uint8_t rnd[MLDSA_RNDBYTES],
+                                 const uint8_t mu[MLDSA_CRHBYTES])
+{
+  keccak_state state;
 
-  /* Compute rhoprime = CRH(key, rnd, mu) */
   shake256_init(&state);
   shake256_absorb(&state, key, MLDSA_SEEDBYTES);
   shake256_absorb(&state, rnd, MLDSA_RNDBYTES);
   shake256_absorb(&state, mu, MLDSA_CRHBYTES);
   shake256_finalize(&state);
   shake256_squeeze(rhoprime, MLDSA_CRHBYTES, &state);
+}
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
+/*************************************************
+ * Name:        mld_sign_expanded
+ *
+ * Description: Rejection loop of ML-DSA.Sign_internal, signing mu with
+ *              an expanded or a compact secret key.
+ *
+ * Arguments:   - uint8_t *sig: output signature (CRYPTO_BYTES bytes)
+ *              - const uint8_t mu[]: message representative mu
+ *              - const uint8_t rhoprime[]: private random seed rho''
+ *              - const polyvecl mat[]: matrix A in NTT domain
+ *              - const polyvecl *s1: secret vector s1 in NTT domain
+ *              - const polyveck *s2: secret vector s2 in NTT domain
+ *              - const polyveck *t0: vector t0 in NTT domain
+ *              - const mld_expanded_csk *csk: compact secret key, or
+ *                NULL; if given, s1, s2 and t0 are taken from it instead,
+ *                and multiplied by the sparse challenge in normal domain
+ **************************************************/
+static void mld_sign_expanded(uint8_t *sig, const uint8_t mu[MLDSA_CRHBYTES],
+                              const uint8_t rhoprime[MLDSA_CRHBYTES],
+                              const polyvecl mat[MLDSA_K], const polyvecl *s1,
+                              const polyveck *s2, const polyveck *t0,
+                              const mld_expanded_csk *csk)
+{
+  unsigned int i, n;
+  uint16_t nonce = 0;
+  uint8_t *hints = sig + MLDSA_CTILDEBYTES + MLDSA_L * MLDSA_POLYZ_PACKEDBYTES;
+  polyvecl y, z;
+  polyveck w1, w0;
+  poly cp, t;
+  mld_sparse_challenge sc;
+  keccak_state state;
+  MLD_TRACE_DECLARE
+
+  MLD_TRACE_START();
 
 rej:
   /* Sample intermediate vector y */
   polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_SAMPLE_Y);
 
   /* Matrix-vector multiplication */
   z = y;
@@ -136,6 +448,7 @@ rej:
   polyveck_caddq(&w1);
   polyveck_decompose(&w1, &w0, &w1);
   polyveck_pack_w1(sig, &w1);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_COMPUTE_W);
 
   shake256_init(&state);
   shake256_absorb(&state, mu, MLDSA_CRHBYTES);
@@ -143,47 +456,257 @@ rej:
   shake256_finalize(&state);
   shake256_squeeze(sig, MLDSA_CTILDEBYTES, &state);
   poly_challenge(&cp, sig);
-  poly_ntt(&cp);
+  if (csk != NULL)
+  {
+    poly_challenge_sparse(&sc, &cp);
+  }
+  else
+  {
+    poly_ntt(&cp);
+  }
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_CHALLENGE);
 
   /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
-  polyvecl_invntt_tomont(&z);
+  if (csk != NULL)
+  {
+    for (i = 0; i < MLDSA_L; ++i)
+    {
+      poly_sparse_mul_s8(&z.vec[i], &sc, csk->s1[i]);
+    }
+  }
+  else
+  {
+    polyvecl_pointwise_poly_montgomery(&z, &cp, s1);
+    polyvecl_invntt_tomont(&z);
+  }
   polyvecl_add(&z, &z, &y);
   polyvecl_reduce(&z);
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+
+  /* Pack z into the signature as its polynomials pass the norm check. This
+   * overwrites the packed w1, which is no longer needed. */
+  for (i = 0; i < MLDSA_L; ++i)
   {
-    goto rej;
+    if (poly_chknorm(&z.vec[i], MLDSA_GAMMA1 - MLDSA_BETA))
+    {
+      MLD_TRACE_STAGE(MLD_TRACE_SIGN_COMPUTE_Z);
+      goto rej;
+    }
+    polyz_pack(sig + MLDSA_CTILDEBYTES + i * MLDSA_POLYZ_PACKEDBYTES,
+               &z.vec[i]);
   }
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_COMPUTE_Z);
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
-  polyveck_invntt_tomont(&h);
-  polyveck_sub(&w0, &w0, &h);
-  polyveck_reduce(&w0);
-  if (polyveck_chknorm(&w0, MLDSA_GAMMA2 - MLDSA_BETA))
+  for (i = 0; i < MLDSA_K; ++i)
   {
-    goto rej;
+    if (csk != NULL)
+    {
+      poly_sparse_mul_s8(&t, &sc, csk->s2[i]);
+    }
+    else
+    {
+      poly_pointwise_montgomery(&t, &cp, &s2->vec[i]);
+      poly_invntt_tomont(&t);
+    }
+    poly_sub(&w0.vec[i], &w0.vec[i], &t);
+    poly_reduce(&w0.vec[i]);
+    if (poly_chknorm(&w0.vec[i], MLDSA_GAMMA2 - MLDSA_BETA))
+    {
+      MLD_TRACE_STAGE(MLD_TRACE_SIGN_CHECK_R0);
+      goto rej;
+    }
   }
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_CHECK_R0);
 
-  /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
-  polyveck_invntt_tomont(&h);
-  polyveck_reduce(&h);
-  if (polyveck_chknorm(&h, MLDSA_GAMMA2))
+  /* Compute hints for w1 and write them straight into the signature: the
+   * indices of the hints go to the first MLDSA_OMEGA bytes of the hint
+   * section, and the running count after each polynomial to the final
+   * MLDSA_K bytes. */
+  n = 0;
+  for (i = 0; i < MLDSA_K; ++i)
   {
-    goto rej;
+    if (csk != NULL)
+    {
+      poly_sparse_mul_s16(&t, &sc, csk->t0[i]);
+    }
+    else
+    {
+      poly_pointwise_montgomery(&t, &cp, &t0->vec[i]);
+      poly_invntt_tomont(&t);
+    }
+    poly_reduce(&t);
+    if (poly_chknorm(&t, MLDSA_GAMMA2))
+    {
+      MLD_TRACE_STAGE(MLD_TRACE_SIGN_MAKE_HINT);
+      goto rej;
+    }
+
+    poly_add(&w0.vec[i], &w0.vec[i], &t);
+    n = poly_make_hint_packed(hints, n, &w0.vec[i], &w1.vec[i]);
+    if (n > MLDSA_OMEGA)
+    {
+      MLD_TRACE_STAGE(MLD_TRACE_SIGN_MAKE_HINT);
+      goto rej;
+    }
+    hints[MLDSA_OMEGA + i] = (uint8_t)n;
   }
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_MAKE_HINT);
+
+  /* The challenge is already in place, so only the unused hint slots are
+   * left to fill */
+  memset(hints + n, 0, MLDSA_OMEGA - n);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_PACK_SIG);
+  /* Each iteration of the rejection loop consumes one nonce */
+  MLD_STATS_SIGNATURE(nonce - 1);
+}
+
+int crypto_sign_signature_internal(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *pre, size_t prelen,
+                                   const uint8_t rnd[MLDSA_RNDBYTES],
+                                   const uint8_t *sk, int externalmu)
+{
+  uint8_t rho[MLDSA_SEEDBYTES];
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  polyvecl mat[MLDSA_K], s1;
+  polyveck t0, s2;
+  MLD_TRACE_DECLARE
+
+  MLD_TRACE_START();
+  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_UNPACK_SK);
+
+  mld_compute_mu(mu, tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_MU);
 
-  polyveck_add(&w0, &w0, &h);
-  n = polyveck_make_hint(&h, &w0, &w1);
-  if (n > MLDSA_OMEGA)
+  mld_compute_rhoprime(rhoprime, key, rnd, mu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_RHOPRIME);
+
+  /* Expand matrix and transform vectors */
+  polyvec_matrix_expand(mat, rho);
+  polyvecl_ntt(&s1);
+  polyveck_ntt(&s2);
+  polyveck_ntt(&t0);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_EXPAND_MATRIX);
+
+  mld_sign_expanded(sig, mu, rhoprime, mat, &s1, &s2, &t0, NULL);
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+
+int crypto_sign_signature_seed_internal(uint8_t *sig, size_t *siglen,
+                                        const uint8_t *m, size_t mlen,
+                                        const uint8_t *pre, size_t prelen,
+                                        const uint8_t rnd[MLDSA_RNDBYTES],
+                                        const uint8_t seed[MLDSA_SEEDBYTES],
+                                        int externalmu)
+{
+  unsigned int i;
+  uint8_t rho[MLDSA_SEEDBYTES];
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t key[MLDSA_SEEDBYTES];
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  uint8_t t1_packed[MLDSA_POLYT1_PACKEDBYTES];
+  polyvecl mat[MLDSA_K], s1, s1hat;
+  polyveck s2, t1, t0;
+  keccak_state state;
+  MLD_TRACE_DECLARE
+
+  /* Expand the seed directly into the matrix and NTT-domain secrets,
+   * without going through pack_sk/unpack_sk */
+  mld_keypair_expand(rho, key, mat, &s1, &s1hat, &s2, &t1, seed);
+  MLD_TRACE_START();
+  polyveck_caddq(&t1);
+  polyveck_power2round(&t1, &t0, &t1);
+
+  /* Compute tr = H(pk) = H(rho, t1) without materializing pk */
+  shake256_init(&state);
+  shake256_absorb(&state, rho, MLDSA_SEEDBYTES);
+  for (i = 0; i < MLDSA_K; ++i)
   {
-    goto rej;
+    polyt1_pack(t1_packed, &t1.vec[i]);
+    shake256_absorb(&state, t1_packed, MLDSA_POLYT1_PACKEDBYTES);
   }
+  shake256_finalize(&state);
+  shake256_squeeze(tr, MLDSA_TRBYTES, &state);
+
+  polyveck_ntt(&s2);
+  polyveck_ntt(&t0);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_UNPACK_SK);
+
+  mld_compute_mu(mu, tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_MU);
 
-  /* Write signature */
-  pack_sig(sig, sig, &z, &h, n);
+  mld_compute_rhoprime(rhoprime, key, rnd, mu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_RHOPRIME);
+
+  mld_sign_expanded(sig, mu, rhoprime, mat, &s1hat, &s2, &t0, NULL);
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const uint8_t *esk, int externalmu)
+{
+  const mld_expanded_sk *e = (const mld_expanded_sk *)esk;
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  MLD_TRACE_DECLARE
+
+  if (!mld_expanded_sk_header_ok(esk))
+  {
+    return -1;
+  }
+
+  MLD_TRACE_START();
+  mld_compute_mu(mu, e->tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_MU);
+
+  mld_compute_rhoprime(rhoprime, e->key, rnd, mu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_RHOPRIME);
+
+  /* The expanded secret key is used in place */
+  mld_sign_expanded(sig, mu, rhoprime, e->mat, &e->s1, &e->s2, &e->t0,
+                    NULL);
+  *siglen = CRYPTO_BYTES;
+  return 0;
+}
+
+int crypto_sign_signature_compact_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const uint8_t *csk, int externalmu)
+{
+  const mld_expanded_csk *e = (const mld_expanded_csk *)csk;
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t rhoprime[MLDSA_CRHBYTES];
+  polyvecl mat[MLDSA_K];
+  MLD_TRACE_DECLARE
+
+  if (!mld_compact_sk_header_ok(csk))
+  {
+    return -1;
+  }
+
+  MLD_TRACE_START();
+  mld_compute_mu(mu, e->tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_MU);
+
+  mld_compute_rhoprime(rhoprime, e->key, rnd, mu);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_RHOPRIME);
+
+  /* Only the matrix is expanded; the secrets are used in place */
+  polyvec_matrix_expand(mat, e->rho);
+  MLD_TRACE_STAGE(MLD_TRACE_SIGN_EXPAND_MATRIX);
+
+  mld_sign_expanded(sig, mu, rhoprime, mat, NULL, NULL, NULL, e);
   *siglen = CRYPTO_BYTES;
   return 0;
 }
@@ -223,6 +746,111 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
   return 0;
 }
 
+int crypto_sign_signature_seed(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                               size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t seed[MLDSA_SEEDBYTES])
+{
+  size_t i;
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  /* Prepare pre = (0, ctxlen, ctx) */
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for (i = 0; i < ctxlen; i++)
+  {
+    pre[2 + i] = ctx[i];
+  }
+
+#ifdef MLD_RANDOMIZED_SIGNING
+  randombytes(rnd, MLDSA_RNDBYTES);
+#else
+  for (i = 0; i < MLDSA_RNDBYTES; i++)
+  {
+    rnd[i] = 0;
+  }
+#endif /* !MLD_RANDOMIZED_SIGNING */
+
+  crypto_sign_signature_seed_internal(sig, siglen, m, mlen, pre, 2 + ctxlen,
+                                      rnd, seed, 0);
+  return 0;
+}
+
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const uint8_t *esk)
+{
+  size_t i;
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  /* Prepare pre = (0, ctxlen, ctx) */
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for (i = 0; i < ctxlen; i++)
+  {
+    pre[2 + i] = ctx[i];
+  }
+
+#ifdef MLD_RANDOMIZED_SIGNING
+  randombytes(rnd, MLDSA_RNDBYTES);
+#else
+  for (i = 0; i < MLDSA_RNDBYTES; i++)
+  {
+    rnd[i] = 0;
+  }
+#endif /* !MLD_RANDOMIZED_SIGNING */
+
+  return crypto_sign_signature_expanded_internal(sig, siglen, m, mlen, pre,
+                                                 2 + ctxlen, rnd, esk, 0);
+}
+
+int crypto_sign_signature_compact(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *csk)
+{
+  size_t i;
+  uint8_t pre[257];
+  uint8_t rnd[MLDSA_RNDBYTES];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  /* Prepare pre = (0, ctxlen, ctx) */
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for (i = 0; i < ctxlen; i++)
+  {
+    pre[2 + i] = ctx[i];
+  }
+
+#ifdef MLD_RANDOMIZED_SIGNING
+  randombytes(rnd, MLDSA_RNDBYTES);
+#else
+  for (i = 0; i < MLDSA_RNDBYTES; i++)
+  {
+    rnd[i] = 0;
+  }
+#endif /* !MLD_RANDOMIZED_SIGNING */
+
+  return crypto_sign_signature_compact_internal(sig, siglen, m, mlen, pre,
+                                                2 + ctxlen, rnd, csk, 0);
+}
+
 int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
                                 const uint8_t mu[MLDSA_CRHBYTES],
                                 const uint8_t *sk)
@@ -243,90 +871,139 @@ int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
   return 0;
 }
 
-int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
-                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
+int crypto_sign_inplace(uint8_t *sm, size_t *smlen, size_t mlen,
+                        const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
 {
   int ret;
-  size_t i;
 
-  for (i = 0; i < mlen; ++i)
-  {
-    sm[CRYPTO_BYTES + mlen - 1 - i] = m[mlen - 1 - i];
-  }
   ret = crypto_sign_signature(sm, smlen, sm + CRYPTO_BYTES, mlen, ctx, ctxlen,
                               sk);
   *smlen += mlen;
   return ret;
 }
 
-int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
-                                const uint8_t *m, size_t mlen,
-                                const uint8_t *pre, size_t prelen,
-                                const uint8_t *pk, int externalmu)
+int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
+                const uint8_t *ctx, size_t ctxlen, const uint8_t *sk)
+{
+  /* m may overlap sm */
+  memmove(sm + CRYPTO_BYTES, m, mlen);
+  return crypto_sign_inplace(sm, smlen, mlen, ctx, ctxlen, sk);
+}
+
+/*************************************************
+ * Name:        mld_verify_expand_pk
+ *
+ * Description: Computes the parts of verification which only depend on
+ *              the public key: the matrix A and NTT(t1 * 2^d). With
+ *              MLD_CONFIG_VERIFY_CACHE, they are taken from the
+ *              verification cache if present, and added to it otherwise.
+ *
+ * Arguments:   - polyvecl mat[]: output matrix A in NTT domain
+ *              - polyveck *t1: output vector NTT(t1 * 2^d)
+ *              - const uint8_t *pk: bit-packed public key
+ *              - const uint8_t tr[]: tr = H(pk) (MLDSA_TRBYTES bytes);
+ *                only used with MLD_CONFIG_VERIFY_CACHE
+ **************************************************/
+static void mld_verify_expand_pk(polyvecl mat[MLDSA_K], polyveck *t1,
+                                 const uint8_t *pk,
+                                 const uint8_t tr[MLDSA_TRBYTES])
 {
-  unsigned int i;
-  uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
   uint8_t rho[MLDSA_SEEDBYTES];
-  uint8_t mu[MLDSA_CRHBYTES];
-  uint8_t c[MLDSA_CTILDEBYTES];
-  uint8_t c2[MLDSA_CTILDEBYTES];
-  poly cp;
-  polyvecl mat[MLDSA_K], z;
-  polyveck t1, w1, h;
-  keccak_state state;
 
-  if (siglen != CRYPTO_BYTES)
+#if defined(MLD_CONFIG_VERIFY_CACHE)
+  if (mld_verify_cache_lookup(mat, t1, tr))
   {
-    return -1;
+    return;
   }
+#else
+  ((void)tr);
+#endif
 
-  unpack_pk(rho, &t1, pk);
-  if (unpack_sig(c, &z, &h, sig))
+  unpack_pk(rho, t1, pk);
+  polyvec_matrix_expand(mat, rho);
+  polyveck_shiftl(t1);
+  polyveck_ntt(t1);
+
+#if defined(MLD_CONFIG_VERIFY_CACHE)
+  mld_verify_cache_insert(tr, mat, t1);
+#endif
+}
+
+/*************************************************
+ * Name:        mld_verify_unpack
+ *
+ * Description: Unpacks a signature and checks the length, hint encoding
+ *              and norm of z.
+ *
+ * Returns 0 if the signature is well-formed, and -1 otherwise
+ **************************************************/
+static int mld_verify_unpack(uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z,
+                             uint8_t h[MLDSA_POLYVECH_PACKEDBYTES],
+                             const uint8_t *sig, size_t siglen)
+{
+  if (siglen != CRYPTO_BYTES)
   {
     return -1;
   }
-  if (polyvecl_chknorm(&z, MLDSA_GAMMA1 - MLDSA_BETA))
+  if (unpack_sig(c, z, h, sig))
   {
     return -1;
   }
-
-  if (!externalmu)
-  {
-    /* Compute CRH(H(rho, t1), pre, msg) */
-    shake256(mu, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
-    shake256_init(&state);
-    shake256_absorb(&state, mu, MLDSA_TRBYTES);
-    shake256_absorb(&state, pre, prelen);
-    shake256_absorb(&state, m, mlen);
-    shake256_finalize(&state);
-    shake256_squeeze(mu, MLDSA_CRHBYTES, &state);
-  }
-  else
+  if (polyvecl_chknorm(z, MLDSA_GAMMA1 - MLDSA_BETA))
   {
-    /* mu has been provided directly */
-    memcpy(mu, m, MLDSA_CRHBYTES);
+    return -1;
   }
+  return 0;
+}
+
+/*************************************************
+ * Name:        mld_verify_core
+ *
+ * Description: Verifies an unpacked signature (c~, z, h) of mu, given the
+ *              parts of the public key used by verification.
+ *
+ * Arguments:   - const uint8_t c[]: commitment hash c~
+ *              - polyvecl *z: response z; overwritten
+ *              - const uint8_t h[]: hints h, in packed form
+ *              - const uint8_t mu[]: message representative mu
+ *              - const polyvecl mat[]: matrix A in NTT domain
+ *              - const polyveck *t1: vector NTT(t1 * 2^d)
+ *
+ * Returns 0 if the signature is valid, and -1 otherwise
+ **************************************************/
+static int mld_verify_core(const uint8_t c[MLDSA_CTILDEBYTES], polyvecl *z,
+                           const uint8_t h[MLDSA_POLYVECH_PACKEDBYTES],
+                           const uint8_t mu[MLDSA_CRHBYTES],
+                           const polyvecl mat[MLDSA_K], const polyveck *t1)
+{
+  unsigned int i;
+  uint8_t buf[MLDSA_K * MLDSA_POLYW1_PACKEDBYTES];
+  uint8_t c2[MLDSA_CTILDEBYTES];
+  poly cp;
+  polyveck ct1, w1;
+  keccak_state state;
+  MLD_TRACE_DECLARE
+
+  MLD_TRACE_START();
 
   /* Matrix-vector multiplication; compute Az - c2^dt1 */
   poly_challenge(&cp, c);
-  polyvec_matrix_expand(mat, rho);
-
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvecl_ntt(z);
+  polyvec_matrix_pointwise_montgomery(&w1, mat, z);
 
   poly_ntt(&cp);
-  polyveck_shiftl(&t1);
-  polyveck_ntt(&t1);
-  polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
+  polyveck_pointwise_poly_montgomery(&ct1, &cp, t1);
 
-  polyveck_sub(&w1, &w1, &t1);
+  polyveck_sub(&w1, &w1, &ct1);
   polyveck_reduce(&w1);
   polyveck_invntt_tomont(&w1);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_COMPUTE_W);
 
   /* Reconstruct w1 */
   polyveck_caddq(&w1);
-  polyveck_use_hint(&w1, &w1, &h);
+  polyveck_use_hint(&w1, &w1, h);
   polyveck_pack_w1(buf, &w1);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_USE_HINT);
 
   /* Call random oracle and verify challenge */
   shake256_init(&state);
@@ -334,6 +1011,7 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
   shake256_absorb(&state, buf, MLDSA_K * MLDSA_POLYW1_PACKEDBYTES);
   shake256_finalize(&state);
   shake256_squeeze(c2, MLDSA_CTILDEBYTES, &state);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_CHALLENGE);
   for (i = 0; i < MLDSA_CTILDEBYTES; ++i)
   {
     if (c[i] != c2[i])
@@ -345,6 +1023,75 @@ int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
   return 0;
 }
 
+int crypto_sign_verify_internal(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *pre, size_t prelen,
+                                const uint8_t *pk, int externalmu)
+{
+  uint8_t tr[MLDSA_TRBYTES];
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t c[MLDSA_CTILDEBYTES];
+  polyvecl mat[MLDSA_K], z;
+  uint8_t h[MLDSA_POLYVECH_PACKEDBYTES];
+  polyveck t1;
+  MLD_TRACE_DECLARE
+
+  MLD_TRACE_START();
+  if (mld_verify_unpack(c, &z, h, sig, siglen))
+  {
+    return -1;
+  }
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_UNPACK);
+
+  /* Compute H(rho, t1); the verification cache is keyed by it */
+#if !defined(MLD_CONFIG_VERIFY_CACHE)
+  if (!externalmu)
+#endif
+  {
+    shake256(tr, MLDSA_TRBYTES, pk, CRYPTO_PUBLICKEYBYTES);
+  }
+
+  /* Compute CRH(H(rho, t1), pre, msg) */
+  mld_compute_mu(mu, tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_MU);
+
+  mld_verify_expand_pk(mat, &t1, pk, tr);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_EXPAND_MATRIX);
+
+  return mld_verify_core(c, &z, h, mu, mat, &t1);
+}
+
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const uint8_t *epk, int externalmu)
+{
+  const mld_expanded_pk *e = (const mld_expanded_pk *)epk;
+  uint8_t mu[MLDSA_CRHBYTES];
+  uint8_t c[MLDSA_CTILDEBYTES];
+  polyvecl z;
+  uint8_t h[MLDSA_POLYVECH_PACKEDBYTES];
+  MLD_TRACE_DECLARE
+
+  if (!mld_expanded_pk_header_ok(epk))
+  {
+    return -1;
+  }
+
+  MLD_TRACE_START();
+  if (mld_verify_unpack(c, &z, h, sig, siglen))
+  {
+    return -1;
+  }
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_UNPACK);
+
+  mld_compute_mu(mu, e->tr, pre, prelen, m, mlen, externalmu);
+  MLD_TRACE_STAGE(MLD_TRACE_VERIFY_MU);
+
+  /* The expanded public key is used in place */
+  return mld_verify_core(c, &z, h, mu, e->mat, &e->t1);
+}
+
 int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                        size_t mlen, const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk)
@@ -368,6 +1115,30 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                                      0);
 }
 
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const uint8_t *epk)
+{
+  size_t i;
+  uint8_t pre[257];
+
+  if (ctxlen > 255)
+  {
+    return -1;
+  }
+
+  pre[0] = 0;
+  pre[1] = ctxlen;
+  for (i = 0; i < ctxlen; i++)
+  {
+    pre[2 + i] = ctx[i];
+  }
+
+  return crypto_sign_verify_expanded_internal(sig, siglen, m, mlen, pre,
+                                              2 + ctxlen, epk, 0);
+}
+
 int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
                              const uint8_t mu[MLDSA_CRHBYTES],
                              const uint8_t *pk)
@@ -375,39 +1146,49 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
   return crypto_sign_verify_internal(sig, siglen, mu, 0, NULL, 0, pk, 1);
 }
 
-int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
-                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
+int crypto_sign_open_inplace(const uint8_t **m, size_t *mlen,
+                             const uint8_t *sm, size_t smlen,
+                             const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *pk)
 {
-  size_t i;
-
-  if (smlen < CRYPTO_BYTES)
+  if (smlen < CRYPTO_BYTES ||
+      crypto_sign_verify(sm, CRYPTO_BYTES, sm + CRYPTO_BYTES,
+                         smlen - CRYPTO_BYTES, ctx, ctxlen, pk))
   {
-    goto badsig;
+    /* Signature verification failed */
+    *m = NULL;
+    *mlen = 0;
+    return -1;
   }
 
+  *m = sm + CRYPTO_BYTES;
   *mlen = smlen - CRYPTO_BYTES;
-  if (crypto_sign_verify(sm, CRYPTO_BYTES, sm + CRYPTO_BYTES, *mlen, ctx,
-                         ctxlen, pk))
-  {
-    goto badsig;
-  }
-  else
-  {
-    /* All good, copy msg, return 0 */
-    for (i = 0; i < *mlen; ++i)
-    {
-      m[i] = sm[CRYPTO_BYTES + i];
-    }
-    return 0;
-  }
+  return 0;
+}
 
-badsig:
-  /* Signature verification failed */
-  *mlen = 0;
-  for (i = 0; i < smlen; ++i)
+int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
+                     const uint8_t *ctx, size_t ctxlen, const uint8_t *pk)
+{
+  const uint8_t *msg;
+
+  if (crypto_sign_open_inplace(&msg, mlen, sm, smlen, ctx, ctxlen, pk))
   {
-    m[i] = 0;
+    memset(m, 0, smlen);
+    return -1;
   }
 
-  return -1;
+  /* All good, copy msg, return 0; m may be equal to sm */
+  memmove(m, msg, *mlen);
+  return 0;
 }
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef mld_keypair_expand
+#undef mld_compute_mu
+#undef mld_compute_rhoprime
+#undef mld_sign_expanded
+#undef mld_keypair_x4
+#undef mld_verify_expand_pk
+#undef mld_verify_unpack
+#undef mld_verify_core
@@ -46,6 +46,85 @@ int crypto_sign_keypair_internal(uint8_t *pk, uint8_t *sk,
  **************************************************/
 int crypto_sign_keypair(uint8_t *pk, uint8_t *sk);
 
+#define crypto_sign_keypair_batch_internal \
+  MLD_NAMESPACE(keypair_batch_internal)
+/*************************************************
+ * Name:        crypto_sign_keypair_batch_internal
+ *
+ * Description: Generates n key pairs from n seeds. Key pair i is the
+ *              same as computed by crypto_sign_keypair_internal for
+ *              seed i.
+ *
+ *              Groups of four key pairs are computed together, sampling
+ *              their matrices A via four-way SHAKE128; the remaining key
+ *              pairs are computed one by one.
+ *
+ * Arguments:   - uint8_t *pk:          pointer to output public keys
+ *                                      (n * CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk:          pointer to output secret keys
+ *                                      (n * CRYPTO_SECRETKEYBYTES bytes)
+ *              - const uint8_t *seeds: pointer to input seeds
+ *                                      (n * MLDSA_SEEDBYTES bytes)
+ *              - size_t n:             number of key pairs
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_keypair_batch_internal(uint8_t *pk, uint8_t *sk,
+                                       const uint8_t *seeds, size_t n);
+
+#define crypto_sign_keypair_batch MLD_NAMESPACE(keypair_batch)
+/*************************************************
+ * Name:        crypto_sign_keypair_batch
+ *
+ * Description: FIPS 204: Algorithm 1 ML-DSA.KeyGen, for n key pairs.
+ *              Generates n public and private keys, amortizing the cost
+ *              of matrix expansion over groups of four key pairs.
+ *
+ * Arguments:   - uint8_t *pk: pointer to output public keys
+ *                             (n * CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *sk: pointer to output private keys
+ *                             (n * CRYPTO_SECRETKEYBYTES bytes)
+ *              - size_t n:    number of key pairs
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_keypair_batch(uint8_t *pk, uint8_t *sk, size_t n);
+
+#define crypto_sign_pk_from_seed MLD_NAMESPACE(pk_from_seed)
+/*************************************************
+ * Name:        crypto_sign_pk_from_seed
+ *
+ * Description: Derives the public key from a seed-only secret key, i.e.,
+ *              the seed xi of FIPS 204 Algorithm 6 ML-DSA.KeyGen_internal.
+ *              The expanded secret key for a seed is obtained from
+ *              crypto_sign_keypair_internal.
+ *
+ * Arguments:   - uint8_t *pk:   pointer to output public key (allocated
+ *                               array of CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *seed: pointer to input seed (MLDSA_SEEDBYTES
+ *                               bytes)
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_pk_from_seed(uint8_t *pk, const uint8_t seed[MLDSA_SEEDBYTES]);
+
+#define crypto_sign_keypair_seed MLD_NAMESPACE(keypair_seed)
+/*************************************************
+ * Name:        crypto_sign_keypair_seed
+ *
+ * Description: FIPS 204: Algorithm 1 ML-DSA.KeyGen, returning the
+ *              secret key in seed-only form.
+ *              Generates a random seed and the corresponding public key.
+ *
+ * Arguments:   - uint8_t *pk:   pointer to output public key (allocated
+ *                               array of CRYPTO_PUBLICKEYBYTES bytes)
+ *              - uint8_t *seed: pointer to output seed (MLDSA_SEEDBYTES
+ *                               bytes)
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_keypair_seed(uint8_t *pk, uint8_t seed[MLDSA_SEEDBYTES]);
+
 #define crypto_sign_signature_internal MLD_NAMESPACE(signature_internal)
 /*************************************************
  * Name:        crypto_sign_signature_internal
@@ -93,6 +172,169 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen, const uint8_t *m,
                           size_t mlen, const uint8_t *ctx, size_t ctxlen,
                           const uint8_t *sk);
 
+#define crypto_sign_signature_expanded_internal \
+  MLD_NAMESPACE(signature_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded_internal
+ *
+ * Description: Computes signature using an expanded secret key, as
+ *              produced by crypto_sign_expand_sk. Internal API.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *pre:   pointer to prefix string
+ *              - size_t prelen:  length of prefix string
+ *              - uint8_t *rnd:   pointer to random seed
+ *              - uint8_t *esk:   pointer to expanded secret key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 (success) or -1 (invalid header or misaligned expanded key)
+ **************************************************/
+int crypto_sign_signature_expanded_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const uint8_t *esk, int externalmu);
+
+#define crypto_sign_signature_expanded MLD_NAMESPACE(signature_expanded)
+/*************************************************
+ * Name:        crypto_sign_signature_expanded
+ *
+ * Description: Computes signature using an expanded secret key, as
+ *              produced by crypto_sign_expand_sk. The signature is the
+ *              same as crypto_sign_signature would produce for the secret
+ *              key the expanded key was derived from.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *ctx:   pointer to contex string
+ *              - size_t ctxlen:  length of contex string
+ *              - uint8_t *esk:   pointer to expanded secret key
+ *
+ * Returns 0 (success) or -1 (context string too long, invalid header or
+ * misaligned expanded key)
+ **************************************************/
+int crypto_sign_signature_expanded(uint8_t *sig, size_t *siglen,
+                                   const uint8_t *m, size_t mlen,
+                                   const uint8_t *ctx, size_t ctxlen,
+                                   const uint8_t *esk);
+
+#define crypto_sign_signature_compact_internal \
+  MLD_NAMESPACE(signature_compact_internal)
+/*************************************************
+ * Name:        crypto_sign_signature_compact_internal
+ *
+ * Description: Computes signature using a compact secret key, as
+ *              produced by crypto_sign_compact_sk. Internal API.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *pre:   pointer to prefix string
+ *              - size_t prelen:  length of prefix string
+ *              - uint8_t *rnd:   pointer to random seed
+ *              - uint8_t *csk:   pointer to compact secret key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 (success) or -1 (invalid header or misaligned compact key)
+ **************************************************/
+int crypto_sign_signature_compact_internal(
+    uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+    const uint8_t *pre, size_t prelen, const uint8_t rnd[MLDSA_RNDBYTES],
+    const uint8_t *csk, int externalmu);
+
+#define crypto_sign_signature_compact MLD_NAMESPACE(signature_compact)
+/*************************************************
+ * Name:        crypto_sign_signature_compact
+ *
+ * Description: Computes signature using a compact secret key, as
+ *              produced by crypto_sign_compact_sk. The signature is the
+ *              same as crypto_sign_signature would produce for the secret
+ *              key the compact key was derived from.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *                                CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *ctx:   pointer to contex string
+ *              - size_t ctxlen:  length of contex string
+ *              - uint8_t *csk:   pointer to compact secret key
+ *
+ * Returns 0 (success) or -1 (context string too long, invalid header or
+ * misaligned compact key)
+ **************************************************/
+int crypto_sign_signature_compact(uint8_t *sig, size_t *siglen,
+                                  const uint8_t *m, size_t mlen,
+                                  const uint8_t *ctx, size_t ctxlen,
+                                  const uint8_t *csk);
+
+#define crypto_sign_signature_seed_internal \
+  MLD_NAMESPACE(signature_seed_internal)
+/*************************************************
+ * Name:        crypto_sign_signature_seed_internal
+ *
+ * Description: Computes signature from a seed-only secret key.
+ *              Internal API.
+ *
+ *              The seed is expanded directly into the matrix A and the
+ *              NTT-domain secret vectors, avoiding the bit-packed secret
+ *              key. The signature is identical to that computed by
+ *              crypto_sign_signature_internal for the secret key obtained
+ *              from crypto_sign_keypair_internal with the same seed.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *pre:   pointer to prefix string
+ *              - size_t prelen:  length of prefix string
+ *              - uint8_t *rnd:   pointer to random seed
+ *              - uint8_t *seed:  pointer to seed-only secret key
+ *                                (MLDSA_SEEDBYTES bytes)
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 (success)
+ **************************************************/
+int crypto_sign_signature_seed_internal(uint8_t *sig, size_t *siglen,
+                                        const uint8_t *m, size_t mlen,
+                                        const uint8_t *pre, size_t prelen,
+                                        const uint8_t rnd[MLDSA_RNDBYTES],
+                                        const uint8_t seed[MLDSA_SEEDBYTES],
+                                        int externalmu);
+
+#define crypto_sign_signature_seed MLD_NAMESPACE(signature_seed)
+/*************************************************
+ * Name:        crypto_sign_signature_seed
+ *
+ * Description: FIPS 204: Algorithm 2 ML-DSA.Sign, using a seed-only
+ *              secret key.
+ *              Computes signature.
+ *
+ * Arguments:   - uint8_t *sig:   pointer to output signature (of length
+ *CRYPTO_BYTES)
+ *              - size_t *siglen: pointer to output length of signature
+ *              - uint8_t *m:     pointer to message to be signed
+ *              - size_t mlen:    length of message
+ *              - uint8_t *ctx:   pointer to contex string
+ *              - size_t ctxlen:  length of contex string
+ *              - uint8_t *seed:  pointer to seed-only secret key
+ *                                (MLDSA_SEEDBYTES bytes)
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_signature_seed(uint8_t *sig, size_t *siglen, const uint8_t *m,
+                               size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                               const uint8_t seed[MLDSA_SEEDBYTES]);
+
 #define crypto_sign_signature_extmu MLD_NAMESPACE(signature_extmu)
 /*************************************************
  * Name:        crypto_sign_signature_extmu
@@ -134,6 +376,30 @@ int crypto_sign_signature_extmu(uint8_t *sig, size_t *siglen,
 int crypto_sign(uint8_t *sm, size_t *smlen, const uint8_t *m, size_t mlen,
                 const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
 
+#define crypto_sign_inplace MLD_NAMESPACE(inplace)
+/*************************************************
+ * Name:        crypto_sign_inplace
+ *
+ * Description: Compute signed message in place, without copying the
+ *              message.
+ *
+ * Arguments:   - uint8_t *sm: pointer to signed message (allocated
+ *                             array with CRYPTO_BYTES + mlen bytes);
+ *                             on input, the message to be signed is at
+ *                             sm + CRYPTO_BYTES, and on output, sm
+ *                             holds the signed message
+ *              - size_t *smlen: pointer to output length of signed
+ *                               message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *sk: pointer to bit-packed secret key
+ *
+ * Returns 0 (success) or -1 (context string too long)
+ **************************************************/
+int crypto_sign_inplace(uint8_t *sm, size_t *smlen, size_t mlen,
+                        const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+
 #define crypto_sign_verify_internal MLD_NAMESPACE(verify_internal)
 /*************************************************
  * Name:        crypto_sign_verify_internal
@@ -177,6 +443,52 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen, const uint8_t *m,
                        size_t mlen, const uint8_t *ctx, size_t ctxlen,
                        const uint8_t *pk);
 
+#define crypto_sign_verify_expanded_internal \
+  MLD_NAMESPACE(verify_expanded_internal)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded_internal
+ *
+ * Description: Verifies signature using an expanded public key, as
+ *              produced by crypto_sign_expand_pk. Internal API.
+ *
+ * Arguments:   - uint8_t *m: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *pre: pointer to prefix string
+ *              - size_t prelen: length of prefix string
+ *              - const uint8_t *epk: pointer to expanded public key
+ *              - int externalmu: indicates input message m is processed as mu
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded_internal(const uint8_t *sig, size_t siglen,
+                                         const uint8_t *m, size_t mlen,
+                                         const uint8_t *pre, size_t prelen,
+                                         const uint8_t *epk, int externalmu);
+
+#define crypto_sign_verify_expanded MLD_NAMESPACE(verify_expanded)
+/*************************************************
+ * Name:        crypto_sign_verify_expanded
+ *
+ * Description: Verifies signature using an expanded public key, as
+ *              produced by crypto_sign_expand_pk.
+ *
+ * Arguments:   - uint8_t *m: pointer to input signature
+ *              - size_t siglen: length of signature
+ *              - const uint8_t *m: pointer to message
+ *              - size_t mlen: length of message
+ *              - const uint8_t *ctx: pointer to context string
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *epk: pointer to expanded public key
+ *
+ * Returns 0 if signature could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_verify_expanded(const uint8_t *sig, size_t siglen,
+                                const uint8_t *m, size_t mlen,
+                                const uint8_t *ctx, size_t ctxlen,
+                                const uint8_t *epk);
+
 #define crypto_sign_verify_extmu MLD_NAMESPACE(verify_extmu)
 /*************************************************
  * Name:        crypto_sign_verify_extmu
@@ -215,4 +527,28 @@ int crypto_sign_verify_extmu(const uint8_t *sig, size_t siglen,
 int crypto_sign_open(uint8_t *m, size_t *mlen, const uint8_t *sm, size_t smlen,
                      const uint8_t *ctx, size_t ctxlen, const uint8_t *pk);
 
+#define crypto_sign_open_inplace MLD_NAMESPACE(open_inplace)
+/*************************************************
+ * Name:        crypto_sign_open_inplace
+ *
+ * Description: Verify signed message in place, without copying the
+ *              message.
+ *
+ * Arguments:   - const uint8_t **m: pointer to output pointer to the
+ *                                   message within sm, or NULL if
+ *                                   verification failed
+ *              - size_t *mlen: pointer to output length of message
+ *              - const uint8_t *sm: pointer to signed message
+ *              - size_t smlen: length of signed message
+ *              - const uint8_t *ctx: pointer to context tring
+ *              - size_t ctxlen: length of context string
+ *              - const uint8_t *pk: pointer to bit-packed public key
+ *
+ * Returns 0 if signed message could be verified correctly and -1 otherwise
+ **************************************************/
+int crypto_sign_open_inplace(const uint8_t **m, size_t *mlen,
+                             const uint8_t *sm, size_t smlen,
+                             const uint8_t *ctx, size_t ctxlen,
+                             const uint8_t *pk);
+
 #endif /* !MLD_SIGN_H */
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NOTE: You can remove this file unless you compile with MLD_CONFIG_STATS. */
+
+#include "common.h"
+
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+
+#include <string.h>
+#include "fips202/fips202.h"
+#include "stats.h"
+
+MLD_THREAD_LOCAL mld_stats mld_stats_counters;
+
+void mld_stats_get(mld_stats *stats)
+{
+  *stats = mld_stats_counters;
+  stats->keccak_permutations = mld_keccakf1600_permutations;
+}
+
+void mld_stats_reset(void)
+{
+  memset(&mld_stats_counters, 0, sizeof(mld_stats_counters));
+  mld_keccakf1600_permutations = 0;
+}
+
+#else /* MLD_CONFIG_STATS && !CBMC */
+
+MLD_EMPTY_CU(stats)
+
+#endif /* !(MLD_CONFIG_STATS && !CBMC) */
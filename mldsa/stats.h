@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_STATS_H
+#define MLD_STATS_H
+#include "common.h"
+
+#if defined(MLD_CONFIG_STATS) && !defined(CBMC)
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#define MLD_THREAD_LOCAL __declspec(thread)
+#else
+#define MLD_THREAD_LOCAL __thread
+#endif
+
+/* Number of buckets in the rejection histogram. The last bucket
+ * collects all signatures with at least MLD_STATS_REJ_BUCKETS - 1
+ * rejections. */
+#define MLD_STATS_REJ_BUCKETS 16
+
+typedef struct
+{
+  /* Calls to the Keccak-f[1600] permutation */
+  uint64_t keccak_permutations;
+  /* Calls to poly_ntt() and poly_invntt_tomont() */
+  uint64_t ntts;
+  uint64_t invntts;
+  /* Blocks squeezed by poly_uniform() and poly_uniform_eta() on top of
+   * the initial POLY_UNIFORM_NBLOCKS / POLY_UNIFORM_ETA_NBLOCKS */
+  uint64_t uniform_extra_blocks;
+  uint64_t uniform_eta_extra_blocks;
+  /* Signatures produced by crypto_sign_signature_internal() */
+  uint64_t signatures;
+  /* rejections[i]: number of signatures that needed i rejections */
+  uint64_t rejections[MLD_STATS_REJ_BUCKETS];
+} mld_stats;
+
+/*************************************************
+ * Name:        mld_stats_get
+ *
+ * Description: Copy the operation counters of the calling thread.
+ *
+ *              The counters are shared between all parameter sets linked
+ *              into the same binary.
+ *
+ * Arguments:   - mld_stats *stats: pointer to output counters
+ **************************************************/
+#define mld_stats_get MLD_NAMESPACE_SHARED(stats_get)
+void mld_stats_get(mld_stats *stats);
+
+/*************************************************
+ * Name:        mld_stats_reset
+ *
+ * Description: Reset the operation counters of the calling thread.
+ **************************************************/
+#define mld_stats_reset MLD_NAMESPACE_SHARED(stats_reset)
+void mld_stats_reset(void);
+
+/* Internal: counters of the calling thread, except for the Keccak
+ * counter which lives in the FIPS202 module. */
+#define mld_stats_counters MLD_NAMESPACE_SHARED(stats_counters)
+extern MLD_THREAD_LOCAL mld_stats mld_stats_counters;
+
+#define MLD_STATS_INC(field) (mld_stats_counters.field++)
+#define MLD_STATS_ADD(field, n) (mld_stats_counters.field += (n))
+#define MLD_STATS_SIGNATURE(nrej)                      \
+  do                                                   \
+  {                                                    \
+    unsigned mld_stats_bucket = (nrej);                \
+    if (mld_stats_bucket >= MLD_STATS_REJ_BUCKETS)     \
+    {                                                  \
+      mld_stats_bucket = MLD_STATS_REJ_BUCKETS - 1;    \
+    }                                                  \
+    mld_stats_counters.signatures++;                   \
+    mld_stats_counters.rejections[mld_stats_bucket]++; \
+  } while (0)
+
+#else /* MLD_CONFIG_STATS && !CBMC */
+
+#define MLD_STATS_INC(field) \
+  do                         \
+  {                          \
+  } while (0)
+#define MLD_STATS_ADD(field, n) \
+  do                            \
+  {                             \
+  } while (0)
+#define MLD_STATS_SIGNATURE(nrej) \
+  do                              \
+  {                               \
+  } while (0)
+
+#endif /* !(MLD_CONFIG_STATS && !CBMC) */
+#endif /* !MLD_STATS_H */
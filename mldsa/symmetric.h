@@ -11,10 +11,11 @@
 
 #include "fips202/fips202.h"
 
-typedef keccak_state stream128_state;
-typedef keccak_state stream256_state;
+#define stream128_state keccak_state
+#define stream256_state keccak_state
 
-#define mldsa_shake128_stream_init MLD_NAMESPACE(mldsa_shake128_stream_init)
+#define mldsa_shake128_stream_init MLD_NAMESPACE_SHARED(mldsa_shake128_stream_init)
+MLD_INTERNAL_API
 void mldsa_shake128_stream_init(keccak_state *state,
                                 const uint8_t seed[MLDSA_SEEDBYTES],
                                 uint16_t nonce)
@@ -25,7 +26,8 @@ __contract__(
   ensures(state->pos <= SHAKE128_RATE)
 );
 
-#define mldsa_shake256_stream_init MLD_NAMESPACE(mldsa_shake256_stream_init)
+#define mldsa_shake256_stream_init MLD_NAMESPACE_SHARED(mldsa_shake256_stream_init)
+MLD_INTERNAL_API
 void mldsa_shake256_stream_init(keccak_state *state,
                                 const uint8_t seed[MLDSA_CRHBYTES],
                                 uint16_t nonce)
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NOTE: You can remove this file if you set
+ * MLD_CONFIG_CUSTOM_CAPABILITY_FUNC and provide your own
+ * mld_sys_check_capability(). */
+
+#include <stdint.h>
+#include "common.h"
+
+#if !defined(MLD_CONFIG_CUSTOM_CAPABILITY_FUNC)
+
+#if defined(MLD_SYS_AARCH64) && defined(__linux__)
+#include <sys/auxv.h>
+/* From <asm/hwcap.h>, which is not available on all toolchains */
+#define MLD_HWCAP_SHA3 (1ul << 17)
+#define MLD_HWCAP2_SVE2 (1ul << 1)
+#endif
+
+/* Bitmask of supported capabilities, indexed by mld_sys_cap, with bit
+ * MLD_SYS_CAPS_PROBED set once the host has been probed.
+ *
+ * Threads may call mld_sys_check_capability() concurrently, so the
+ * bitmask is accessed atomically where the compiler supports it. Probing
+ * is idempotent and the bitmask is self-contained, so relaxed ordering
+ * suffices; concurrent first calls merely probe more than once. See
+ * sys.h for compilers without atomics. */
+#define MLD_SYS_CAPS_PROBED (1u << 31)
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+static _Atomic unsigned mld_sys_caps = 0;
+#define MLD_SYS_CAPS_LOAD() \
+  atomic_load_explicit(&mld_sys_caps, memory_order_relaxed)
+#define MLD_SYS_CAPS_STORE(v) \
+  atomic_store_explicit(&mld_sys_caps, (v), memory_order_relaxed)
+#elif defined(__GNUC__)
+static unsigned mld_sys_caps = 0;
+#define MLD_SYS_CAPS_LOAD() __atomic_load_n(&mld_sys_caps, __ATOMIC_RELAXED)
+#define MLD_SYS_CAPS_STORE(v) \
+  __atomic_store_n(&mld_sys_caps, (v), __ATOMIC_RELAXED)
+#else
+static unsigned mld_sys_caps = 0;
+#define MLD_SYS_CAPS_LOAD() (mld_sys_caps)
+#define MLD_SYS_CAPS_STORE(v) (mld_sys_caps = (v))
+#endif
+
+#if defined(MLD_SYS_X86_64) && defined(MLD_HAVE_INLINE_ASM)
+static void mld_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+  __asm__ volatile("cpuid"
+                   : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3])
+                   : "a"(leaf), "c"(subleaf));
+}
+
+static uint64_t mld_xgetbv(void)
+{
+  uint32_t lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+static unsigned mld_sys_probe(void)
+{
+  uint32_t regs[4];
+  unsigned caps = 0;
+
+  mld_cpuid(0, 0, regs);
+  if (regs[0] < 7)
+  {
+    return caps;
+  }
+
+  /* AVX requires OS support for saving the YMM registers: check
+   * OSXSAVE and AVX in CPUID.1:ECX, then XMM/YMM state in XCR0. */
+  mld_cpuid(1, 0, regs);
+  if ((regs[2] & (1u << 27)) == 0 || (regs[2] & (1u << 28)) == 0 ||
+      (mld_xgetbv() & 0x6) != 0x6)
+  {
+    return caps;
+  }
+
+  mld_cpuid(7, 0, regs);
+  if (regs[1] & (1u << 5))
+  {
+    caps |= 1u << MLD_SYS_CAP_AVX2;
+  }
+
+  /* AVX-512F in CPUID.7:EBX, and OS support for the opmask and ZMM
+   * state in XCR0 */
+  if ((regs[1] & (1u << 16)) && (mld_xgetbv() & 0xe6) == 0xe6)
+  {
+    caps |= 1u << MLD_SYS_CAP_AVX512;
+  }
+  return caps;
+}
+
+#elif defined(MLD_SYS_AARCH64) && defined(__linux__)
+static unsigned mld_sys_probe(void)
+{
+  unsigned caps = 0;
+  if (getauxval(AT_HWCAP) & MLD_HWCAP_SHA3)
+  {
+    caps |= 1u << MLD_SYS_CAP_SHA3;
+  }
+#if defined(AT_HWCAP2)
+  if (getauxval(AT_HWCAP2) & MLD_HWCAP2_SVE2)
+  {
+    caps |= 1u << MLD_SYS_CAP_SVE2;
+  }
+#endif
+  return caps;
+}
+
+#else
+/* No runtime detection available: rely on compile-time feature macros,
+ * assuming that the binary is only run on hosts it was built for. */
+static unsigned mld_sys_probe(void)
+{
+  unsigned caps = 0;
+#if defined(MLD_SYS_X86_64_AVX2)
+  caps |= 1u << MLD_SYS_CAP_AVX2;
+#endif
+#if defined(MLD_SYS_X86_64) && defined(__AVX512F__)
+  caps |= 1u << MLD_SYS_CAP_AVX512;
+#endif
+#if defined(MLD_SYS_AARCH64) && defined(__ARM_FEATURE_SHA3)
+  caps |= 1u << MLD_SYS_CAP_SHA3;
+#endif
+#if defined(MLD_SYS_AARCH64) && defined(__ARM_FEATURE_SVE2)
+  caps |= 1u << MLD_SYS_CAP_SVE2;
+#endif
+  return caps;
+}
+#endif /* !(MLD_SYS_X86_64 && MLD_HAVE_INLINE_ASM) && !(MLD_SYS_AARCH64 && \
+          __linux__) */
+
+int mld_sys_check_capability(mld_sys_cap cap)
+{
+  unsigned caps = MLD_SYS_CAPS_LOAD();
+  if ((caps & MLD_SYS_CAPS_PROBED) == 0)
+  {
+    caps = mld_sys_probe() | MLD_SYS_CAPS_PROBED;
+    MLD_SYS_CAPS_STORE(caps);
+  }
+  return (caps >> cap) & 1;
+}
+
+#else /* !MLD_CONFIG_CUSTOM_CAPABILITY_FUNC */
+
+MLD_EMPTY_CU(sys)
+
+#endif /* MLD_CONFIG_CUSTOM_CAPABILITY_FUNC */
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef MLD_HWCAP_SHA3
+#undef MLD_HWCAP2_SVE2
+#undef MLD_SYS_CAPS_PROBED
+#undef MLD_SYS_CAPS_LOAD
+#undef MLD_SYS_CAPS_STORE
@@ -170,4 +170,59 @@
 #define MLD_MUST_CHECK_RETURN_VALUE
 #endif
 
+/* Qualifier for declarations of functions which are internal to the
+ * library, see MLD_CONFIG_INTERNAL_API_QUALIFIER in config.h. */
+#if defined(MLD_CONFIG_INTERNAL_API_QUALIFIER)
+#define MLD_INTERNAL_API MLD_CONFIG_INTERNAL_API_QUALIFIER
+#else
+#define MLD_INTERNAL_API
+#endif
+
+#if !defined(__ASSEMBLER__)
+/* System capabilities that native backends may depend on */
+typedef enum
+{
+  MLD_SYS_CAP_AVX2,
+  MLD_SYS_CAP_SHA3,
+  MLD_SYS_CAP_SVE2,
+  MLD_SYS_CAP_AVX512
+} mld_sys_cap;
+
+/*************************************************
+ * Name:        mld_sys_check_capability
+ *
+ * Description: Check whether the host supports a system capability.
+ *
+ *              Native backends call this before using an optional
+ *              instruction set extension, and fall back to the C code
+ *              if it is not available. This allows a single binary
+ *              containing native code to run on hosts lacking the
+ *              respective extension.
+ *
+ *              The default implementation in sys.c probes the host
+ *              once, on first use, via CPUID on x86_64 and HWCAP on
+ *              AArch64 Linux; elsewhere, it relies on compile-time
+ *              feature macros.
+ *
+ *              It is thread-safe: the cached result is a C11 atomic,
+ *              or accessed through the __atomic builtins with GCC and
+ *              clang in pre-C11 modes. With other pre-C11 compilers,
+ *              the first call must complete before further threads
+ *              use the library, e.g. by calling this function once
+ *              from the main thread at startup.
+ *
+ *              If MLD_CONFIG_CUSTOM_CAPABILITY_FUNC is set, the
+ *              default implementation is omitted and this function must
+ *              be provided by the application, e.g. to force the C
+ *              fallback in tests. It must then be thread-safe, too.
+ *
+ * Arguments:   - mld_sys_cap cap: capability to check
+ *
+ * Returns 1 if the capability is supported, 0 otherwise.
+ **************************************************/
+#define mld_sys_check_capability MLD_NAMESPACE_SHARED(sys_check_capability)
+MLD_INTERNAL_API
+int mld_sys_check_capability(mld_sys_cap cap);
+#endif /* !__ASSEMBLER__ */
+
 #endif /* !MLD_SYS_H */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NOTE: You can remove this file unless you compile with MLD_CONFIG_TRACE. */
+
+#include "common.h"
+
+#if defined(MLD_CONFIG_TRACE)
+
+#include <stddef.h>
+#include "trace.h"
+
+static mld_trace_callback mld_trace_cb = NULL;
+static mld_trace_counter mld_trace_cycles = NULL;
+
+static const char *const mld_trace_stage_names[MLD_TRACE_STAGE_COUNT] = {
+    "keypair/expand_seed", "keypair/expand_matrix", "keypair/sample_s",
+    "keypair/matvec",      "keypair/pack_pk",       "keypair/pack_sk",
+    "sign/unpack_sk",      "sign/mu",               "sign/rhoprime",
+    "sign/expand_matrix",  "sign/sample_y",         "sign/compute_w",
+    "sign/challenge",      "sign/compute_z",        "sign/check_r0",
+    "sign/make_hint",      "sign/pack_sig",         "verify/unpack",
+    "verify/mu",           "verify/expand_matrix",  "verify/compute_w",
+    "verify/use_hint",     "verify/challenge"};
+
+void mld_trace_register(mld_trace_callback cb, mld_trace_counter counter)
+{
+  if (cb == NULL || counter == NULL)
+  {
+    cb = NULL;
+    counter = NULL;
+  }
+  mld_trace_cb = cb;
+  mld_trace_cycles = counter;
+}
+
+const char *mld_trace_stage_name(mld_trace_stage stage)
+{
+  if ((unsigned)stage >= MLD_TRACE_STAGE_COUNT)
+  {
+    return "unknown";
+  }
+  return mld_trace_stage_names[stage];
+}
+
+uint64_t mld_trace_now(void)
+{
+  if (mld_trace_cycles == NULL)
+  {
+    return 0;
+  }
+  return mld_trace_cycles();
+}
+
+void mld_trace_end_stage(mld_trace_stage stage, uint64_t *last)
+{
+  uint64_t now;
+  if (mld_trace_cb == NULL)
+  {
+    return;
+  }
+  now = mld_trace_cycles();
+  mld_trace_cb(stage, now - *last);
+  /* Exclude the callback itself from the next stage */
+  *last = mld_trace_cycles();
+}
+
+#else /* MLD_CONFIG_TRACE */
+
+MLD_EMPTY_CU(trace)
+
+#endif /* !MLD_CONFIG_TRACE */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_TRACE_H
+#define MLD_TRACE_H
+#include "common.h"
+
+#if defined(MLD_CONFIG_TRACE)
+#include <stdint.h>
+
+/* Stages reported to the trace callback.
+ *
+ * Each stage covers the work done since the end of the previous stage of
+ * the same operation. The signing stages from MLD_TRACE_SIGN_SAMPLE_Y
+ * onwards are reported once per iteration of the rejection loop; a
+ * rejected iteration ends with the stage whose check failed. */
+typedef enum
+{
+  /* crypto_sign_keypair_internal */
+  MLD_TRACE_KEYPAIR_EXPAND_SEED,   /* H(xi, k, l) -> rho, rho', K */
+  MLD_TRACE_KEYPAIR_EXPAND_MATRIX, /* ExpandA */
+  MLD_TRACE_KEYPAIR_SAMPLE_S,      /* ExpandS */
+  MLD_TRACE_KEYPAIR_MATVEC,        /* t = A*s1 + s2 */
+  MLD_TRACE_KEYPAIR_PACK_PK,       /* Power2Round, pkEncode */
+  MLD_TRACE_KEYPAIR_PACK_SK,       /* tr = H(pk), skEncode */
+  /* crypto_sign_signature_internal. When signing from a seed, the
+   * KEYPAIR stages up to MLD_TRACE_KEYPAIR_MATVEC are reported first,
+   * and MLD_TRACE_SIGN_UNPACK_SK covers Power2Round and tr = H(pk),
+   * while there is no MLD_TRACE_SIGN_EXPAND_MATRIX. */
+  MLD_TRACE_SIGN_UNPACK_SK,     /* skDecode */
+  MLD_TRACE_SIGN_MU,            /* mu = H(tr, pre, msg) */
+  MLD_TRACE_SIGN_RHOPRIME,      /* rho'' = H(K, rnd, mu) */
+  MLD_TRACE_SIGN_EXPAND_MATRIX, /* ExpandA, NTT of s1, s2, t0 */
+  MLD_TRACE_SIGN_SAMPLE_Y,      /* ExpandMask */
+  MLD_TRACE_SIGN_COMPUTE_W,     /* w = A*y, Decompose, w1Encode */
+  MLD_TRACE_SIGN_CHALLENGE,     /* c~ = H(mu, w1), SampleInBall */
+  MLD_TRACE_SIGN_COMPUTE_Z,     /* z = y + c*s1, norm check */
+  MLD_TRACE_SIGN_CHECK_R0,      /* r0 = w0 - c*s2, norm check */
+  MLD_TRACE_SIGN_MAKE_HINT,     /* c*t0, norm check, MakeHint */
+  MLD_TRACE_SIGN_PACK_SIG,      /* sigEncode */
+  /* crypto_sign_verify_internal */
+  MLD_TRACE_VERIFY_UNPACK,        /* sigDecode, norm check */
+  MLD_TRACE_VERIFY_MU,            /* mu = H(H(pk), pre, msg) */
+  MLD_TRACE_VERIFY_EXPAND_MATRIX, /* pkDecode, ExpandA, NTT(t1*2^d), or
+                                   * verify cache lookup */
+  MLD_TRACE_VERIFY_COMPUTE_W,     /* SampleInBall, w' = A*z - c*t1*2^d */
+  MLD_TRACE_VERIFY_USE_HINT,      /* UseHint, w1Encode */
+  MLD_TRACE_VERIFY_CHALLENGE,     /* H(mu, w1'), compare with c~ */
+  MLD_TRACE_STAGE_COUNT
+} mld_trace_stage;
+
+/* Callback invoked at the end of each stage with the number of cycles
+ * (as reported by the registered cycle counter) spent in it. */
+typedef void (*mld_trace_callback)(mld_trace_stage stage, uint64_t cycles);
+
+/* Cycle counter used to time stages, e.g. get_cyclecounter() from the
+ * benchmarking HAL. */
+typedef uint64_t (*mld_trace_counter)(void);
+
+/*************************************************
+ * Name:        mld_trace_register
+ *
+ * Description: Register the trace callback and cycle counter.
+ *
+ *              Passing NULL for either argument disables tracing.
+ *              The registration is global, shared between all parameter
+ *              sets, and not synchronized; it must not race with keygen,
+ *              signing or verification.
+ *
+ * Arguments:   - mld_trace_callback cb: callback invoked per stage
+ *              - mld_trace_counter counter: cycle counter
+ **************************************************/
+#define mld_trace_register MLD_NAMESPACE_SHARED(trace_register)
+void mld_trace_register(mld_trace_callback cb, mld_trace_counter counter);
+
+/*************************************************
+ * Name:        mld_trace_stage_name
+ *
+ * Description: Return a human-readable name for a trace stage.
+ *
+ * Arguments:   - mld_trace_stage stage: stage identifier
+ *
+ * Returns pointer to a static string, or "unknown" for invalid stages.
+ **************************************************/
+#define mld_trace_stage_name MLD_NAMESPACE_SHARED(trace_stage_name)
+const char *mld_trace_stage_name(mld_trace_stage stage);
+
+#define mld_trace_now MLD_NAMESPACE_SHARED(trace_now)
+MLD_INTERNAL_API
+uint64_t mld_trace_now(void);
+
+#define mld_trace_end_stage MLD_NAMESPACE_SHARED(trace_end_stage)
+MLD_INTERNAL_API
+void mld_trace_end_stage(mld_trace_stage stage, uint64_t *last);
+
+/* Declare the timestamp used by the probes; place with the local
+ * variable declarations of the traced function, without semicolon. */
+#define MLD_TRACE_DECLARE uint64_t mld_trace_last;
+/* Start timing the first stage */
+#define MLD_TRACE_START() (mld_trace_last = mld_trace_now())
+/* End the current stage and start timing the next one */
+#define MLD_TRACE_STAGE(stage) mld_trace_end_stage((stage), &mld_trace_last)
+
+#else /* MLD_CONFIG_TRACE */
+
+#define MLD_TRACE_DECLARE
+#define MLD_TRACE_START() \
+  do                      \
+  {                       \
+  } while (0)
+#define MLD_TRACE_STAGE(stage) \
+  do                           \
+  {                            \
+  } while (0)
+
+#endif /* !MLD_CONFIG_TRACE */
+#endif /* !MLD_TRACE_H */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NOTE: You can remove this file unless you compile with
+ * MLD_CONFIG_VERIFY_CACHE. */
+
+#include "common.h"
+
+#if defined(MLD_CONFIG_VERIFY_CACHE) && !defined(CBMC)
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include "verify_cache.h"
+
+/* Static namespacing
+ * This is to facilitate building multiple instances
+ * of mldsa-native (e.g. with varying parameter sets)
+ * within a single compilation unit. */
+#define mld_verify_cache_entry MLD_NAMESPACE(verify_cache_entry)
+#define mld_verify_cache_shard MLD_NAMESPACE(verify_cache_shard)
+#define mld_verify_cache_locks MLD_NAMESPACE(verify_cache_locks)
+#define mld_verify_cache_shards MLD_NAMESPACE(verify_cache_shards)
+#define mld_verify_cache_find MLD_NAMESPACE(verify_cache_find)
+/* End of static namespacing */
+
+#define MLD_VERIFY_CACHE_SHARD_ENTRIES \
+  (MLD_VERIFY_CACHE_ENTRIES / MLD_VERIFY_CACHE_SHARDS)
+
+typedef struct
+{
+  uint8_t tr[MLDSA_TRBYTES];
+  int valid;
+  /* Value of the shard clock at the last use, for LRU eviction */
+  uint64_t last_use;
+  polyvecl mat[MLDSA_K];
+  polyveck t1;
+} mld_verify_cache_entry;
+
+typedef struct
+{
+  uint64_t clock;
+  uint64_t hits;
+  uint64_t misses;
+  mld_verify_cache_entry entries[MLD_VERIFY_CACHE_SHARD_ENTRIES];
+} mld_verify_cache_shard;
+
+/* mld_verify_cache_locks[i] protects mld_verify_cache_shards[i] */
+static pthread_mutex_t mld_verify_cache_locks[MLD_VERIFY_CACHE_SHARDS] = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER};
+static mld_verify_cache_shard mld_verify_cache_shards[MLD_VERIFY_CACHE_SHARDS];
+
+/* Returns the entry for tr in shard s, or NULL. Must hold the shard lock. */
+static mld_verify_cache_entry *mld_verify_cache_find(
+    mld_verify_cache_shard *s, const uint8_t tr[MLDSA_TRBYTES])
+{
+  unsigned int i;
+  for (i = 0; i < MLD_VERIFY_CACHE_SHARD_ENTRIES; i++)
+  {
+    if (s->entries[i].valid &&
+        memcmp(s->entries[i].tr, tr, MLDSA_TRBYTES) == 0)
+    {
+      return &s->entries[i];
+    }
+  }
+  return NULL;
+}
+
+int mld_verify_cache_lookup(polyvecl mat[MLDSA_K], polyveck *t1,
+                            const uint8_t tr[MLDSA_TRBYTES])
+{
+  unsigned int idx = tr[0] % MLD_VERIFY_CACHE_SHARDS;
+  mld_verify_cache_shard *s = &mld_verify_cache_shards[idx];
+  mld_verify_cache_entry *e;
+
+  pthread_mutex_lock(&mld_verify_cache_locks[idx]);
+  e = mld_verify_cache_find(s, tr);
+  if (e != NULL)
+  {
+    e->last_use = ++s->clock;
+    memcpy(mat, e->mat, sizeof(e->mat));
+    *t1 = e->t1;
+    s->hits++;
+  }
+  else
+  {
+    s->misses++;
+  }
+  pthread_mutex_unlock(&mld_verify_cache_locks[idx]);
+
+  return e != NULL;
+}
+
+void mld_verify_cache_insert(const uint8_t tr[MLDSA_TRBYTES],
+                             const polyvecl mat[MLDSA_K], const polyveck *t1)
+{
+  unsigned int i, idx = tr[0] % MLD_VERIFY_CACHE_SHARDS;
+  mld_verify_cache_shard *s = &mld_verify_cache_shards[idx];
+  mld_verify_cache_entry *e;
+
+  pthread_mutex_lock(&mld_verify_cache_locks[idx]);
+  /* Another thread may have inserted the same public key after our
+   * lookup missed */
+  e = mld_verify_cache_find(s, tr);
+  if (e == NULL)
+  {
+    /* Take a free entry, or else the least recently used one */
+    e = &s->entries[0];
+    for (i = 0; i < MLD_VERIFY_CACHE_SHARD_ENTRIES && e->valid; i++)
+    {
+      if (!s->entries[i].valid || s->entries[i].last_use < e->last_use)
+      {
+        e = &s->entries[i];
+      }
+    }
+    memcpy(e->tr, tr, MLDSA_TRBYTES);
+    memcpy(e->mat, mat, sizeof(e->mat));
+    e->t1 = *t1;
+    e->valid = 1;
+  }
+  e->last_use = ++s->clock;
+  pthread_mutex_unlock(&mld_verify_cache_locks[idx]);
+}
+
+void crypto_sign_verify_cache_stats(uint64_t *hits, uint64_t *misses)
+{
+  unsigned int i;
+
+  *hits = 0;
+  *misses = 0;
+  for (i = 0; i < MLD_VERIFY_CACHE_SHARDS; i++)
+  {
+    pthread_mutex_lock(&mld_verify_cache_locks[i]);
+    *hits += mld_verify_cache_shards[i].hits;
+    *misses += mld_verify_cache_shards[i].misses;
+    pthread_mutex_unlock(&mld_verify_cache_locks[i]);
+  }
+}
+
+void crypto_sign_verify_cache_clear(void)
+{
+  unsigned int i;
+
+  for (i = 0; i < MLD_VERIFY_CACHE_SHARDS; i++)
+  {
+    pthread_mutex_lock(&mld_verify_cache_locks[i]);
+    memset(&mld_verify_cache_shards[i], 0, sizeof(mld_verify_cache_shard));
+    pthread_mutex_unlock(&mld_verify_cache_locks[i]);
+  }
+}
+
+#else /* MLD_CONFIG_VERIFY_CACHE && !CBMC */
+
+MLD_EMPTY_CU(verify_cache)
+
+#endif /* !(MLD_CONFIG_VERIFY_CACHE && !CBMC) */
+
+/* To facilitate single-compilation-unit (SCU) builds, undefine all macros.
+ * Don't modify by hand -- this is auto-generated by scripts/autogen. */
+#undef mld_verify_cache_entry
+#undef mld_verify_cache_shard
+#undef mld_verify_cache_locks
+#undef mld_verify_cache_shards
+#undef mld_verify_cache_find
+#undef MLD_VERIFY_CACHE_SHARD_ENTRIES
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef MLD_VERIFY_CACHE_H
+#define MLD_VERIFY_CACHE_H
+#include "common.h"
+
+#if defined(MLD_CONFIG_VERIFY_CACHE) && !defined(CBMC)
+#include <stdint.h>
+#include "polyvec.h"
+
+#if defined(MLD_CONFIG_VERIFY_CACHE_ENTRIES)
+#define MLD_VERIFY_CACHE_ENTRIES MLD_CONFIG_VERIFY_CACHE_ENTRIES
+#else
+#define MLD_VERIFY_CACHE_ENTRIES 16
+#endif
+
+/* The cache is split into shards with separate locks, selected by the
+ * first byte of tr, so that verifications under different public keys
+ * rarely contend. */
+#define MLD_VERIFY_CACHE_SHARDS 4
+
+#if MLD_VERIFY_CACHE_ENTRIES < MLD_VERIFY_CACHE_SHARDS
+#error MLD_CONFIG_VERIFY_CACHE_ENTRIES must be at least MLD_VERIFY_CACHE_SHARDS
+#endif
+
+#define mld_verify_cache_lookup MLD_NAMESPACE(verify_cache_lookup)
+/*************************************************
+ * Name:        mld_verify_cache_lookup
+ *
+ * Description: Looks up the public key with digest tr = H(pk) in the
+ *              verification cache, and marks it as most recently used.
+ *
+ * Arguments:   - polyvecl mat[]: output matrix A in NTT domain
+ *              - polyveck *t1: output vector NTT(t1 * 2^d)
+ *              - const uint8_t tr[]: public key digest (MLDSA_TRBYTES
+ *                bytes)
+ *
+ * Returns 1 if the public key was found, and 0 otherwise, in which case
+ * mat and t1 are unchanged.
+ **************************************************/
+MLD_INTERNAL_API
+int mld_verify_cache_lookup(polyvecl mat[MLDSA_K], polyveck *t1,
+                            const uint8_t tr[MLDSA_TRBYTES]);
+
+#define mld_verify_cache_insert MLD_NAMESPACE(verify_cache_insert)
+/*************************************************
+ * Name:        mld_verify_cache_insert
+ *
+ * Description: Adds the expanded public key with digest tr = H(pk) to the
+ *              verification cache, evicting the least recently used
+ *              public key of its shard if the shard is full.
+ *
+ * Arguments:   - const uint8_t tr[]: public key digest (MLDSA_TRBYTES
+ *                bytes)
+ *              - const polyvecl mat[]: matrix A in NTT domain
+ *              - const polyveck *t1: vector NTT(t1 * 2^d)
+ **************************************************/
+MLD_INTERNAL_API
+void mld_verify_cache_insert(const uint8_t tr[MLDSA_TRBYTES],
+                             const polyvecl mat[MLDSA_K], const polyveck *t1);
+
+#define crypto_sign_verify_cache_stats MLD_NAMESPACE(verify_cache_stats)
+/*************************************************
+ * Name:        crypto_sign_verify_cache_stats
+ *
+ * Description: Reports the number of verifications which found their
+ *              public key in the cache, and the number which did not,
+ *              since the last call to crypto_sign_verify_cache_clear.
+ *
+ * Arguments:   - uint64_t *hits:   pointer to output number of hits
+ *              - uint64_t *misses: pointer to output number of misses
+ **************************************************/
+void crypto_sign_verify_cache_stats(uint64_t *hits, uint64_t *misses);
+
+#define crypto_sign_verify_cache_clear MLD_NAMESPACE(verify_cache_clear)
+/*************************************************
+ * Name:        crypto_sign_verify_cache_clear
+ *
+ * Description: Removes all public keys from the verification cache and
+ *              resets its counters.
+ **************************************************/
+void crypto_sign_verify_cache_clear(void);
+
+#endif /* MLD_CONFIG_VERIFY_CACHE && !CBMC */
+#endif /* !MLD_VERIFY_CACHE_H */
@@ -0,0 +1,13 @@
+// Copyright (c) 2025 The mldsa-native project authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt.h"
+
+#define mld_fqmul_precomp MLD_NAMESPACE_SHARED(fqmul_precomp)
+
+int32_t mld_fqmul_precomp(int32_t a, int32_t b, int32_t b_qinv);
+void harness(void)
+{
+  int32_t a, b, b_qinv, r;
+  r = mld_fqmul_precomp(a, b, b_qinv);
+}
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include "params.h"
 
+#define mld_invntt_layer MLD_NAMESPACE_SHARED(invntt_layer)
+
 void mld_invntt_layer(int32_t r[MLDSA_N], unsigned layer);
 
 void harness(void)
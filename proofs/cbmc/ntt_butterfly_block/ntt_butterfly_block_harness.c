@@ -4,13 +4,15 @@
 #include <stdint.h>
 #include "params.h"
 
-void mld_ntt_butterfly_block(int32_t r[MLDSA_N], int32_t zeta, unsigned start,
+#define mld_ntt_butterfly_block MLD_NAMESPACE_SHARED(ntt_butterfly_block)
+
+void mld_ntt_butterfly_block(int32_t r[MLDSA_N], unsigned k, unsigned start,
                              unsigned len, int32_t bound);
 
 void harness(void)
 {
-  int32_t *r, zeta;
-  unsigned start, len;
+  int32_t *r;
+  unsigned k, start, len;
   int32_t bound;
-  mld_ntt_butterfly_block(r, zeta, start, len, bound);
+  mld_ntt_butterfly_block(r, k, start, len, bound);
 }
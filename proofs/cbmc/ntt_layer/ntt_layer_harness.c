@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include "params.h"
 
+#define mld_ntt_layer MLD_NAMESPACE_SHARED(ntt_layer)
+
 void mld_ntt_layer(int32_t r[MLDSA_N], unsigned layer);
 
 void harness(void)
@@ -1,11 +1,12 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "poly.h"
+#include "poly_kl.h"
+
 
 void harness(void)
 {
-  poly *a, *b, *c;
-  unsigned int r;
-  r = poly_make_hint(a, b, c);
+  mld_sparse_challenge *sc;
+  poly *c;
+  poly_challenge_sparse(sc, c);
 }
@@ -1,11 +1,13 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "polyvec.h"
+#include "poly_kl.h"
 
 void harness(void)
 {
-  polyveck *a, *b, *c;
+  uint8_t *hints;
+  unsigned int n;
+  poly *a0, *a1;
   unsigned int r;
-  r = polyveck_make_hint(a, b, c);
+  r = poly_make_hint_packed(hints, n, a0, a1);
 }
@@ -1,14 +1,13 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "packing.h"
+#include "poly_kl.h"
 
 
 void harness(void)
 {
-  uint8_t *a, *b;
-  polyveck *h;
-  polyvecl *z;
-  unsigned int nh;
-  pack_sig(a, b, z, h, nh);
+  poly *r;
+  mld_sparse_challenge *sc;
+  int16_t *a;
+  poly_sparse_mul_s16(r, sc, a);
 }
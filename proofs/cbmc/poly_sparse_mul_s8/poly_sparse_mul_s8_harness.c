@@ -1,11 +1,13 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "ntt.h"
+#include "poly_kl.h"
+
 
-int32_t mld_fqmul(int32_t a, int32_t b);
 void harness(void)
 {
-  int32_t a, b, r;
-  r = mld_fqmul(a, b);
+  poly *r;
+  mld_sparse_challenge *sc;
+  int8_t *a;
+  poly_sparse_mul_s8(r, sc, a);
 }
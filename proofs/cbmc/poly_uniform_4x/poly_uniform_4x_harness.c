@@ -0,0 +1,12 @@
+// Copyright (c) 2025 The mldsa-native project authors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "poly.h"
+
+void harness(void)
+{
+  poly *a0, *a1, *a2, *a3;
+  const uint8_t(*seed)[MLDSA_SEEDBYTES + 2];
+
+  poly_uniform_4x(a0, a1, a2, a3, seed);
+}
@@ -1,11 +1,13 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "poly.h"
+#include "poly_kl.h"
 
 
 void harness(void)
 {
-  poly *a, *b, *h;
-  poly_use_hint(b, a, h);
+  poly *a, *b;
+  uint8_t *hints;
+  unsigned int n;
+  poly_use_hint(b, a, hints, n);
 }
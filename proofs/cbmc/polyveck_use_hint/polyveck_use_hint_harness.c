@@ -5,6 +5,7 @@
 
 void harness(void)
 {
-  polyveck *a, *b, *c;
-  polyveck_use_hint(a, b, c);
+  polyveck *a, *b;
+  uint8_t *h;
+  polyveck_use_hint(a, b, h);
 }
@@ -1,7 +1,7 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "poly.h"
+#include "poly_kl.h"
 
 void harness(void)
 {
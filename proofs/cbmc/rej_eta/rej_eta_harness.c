@@ -1,7 +1,9 @@
 // Copyright (c) 2025 The mldsa-native project authors
 // SPDX-License-Identifier: Apache-2.0
 
-#include "poly.h"
+#include "poly_kl.h"
+
+#define rej_eta MLD_NAMESPACE(rej_eta)
 
 static unsigned int rej_eta(int32_t *a, unsigned int target,
                             unsigned int offset, const uint8_t *buf,
@@ -3,6 +3,8 @@
 
 #include "poly.h"
 
+#define rej_uniform MLD_NAMESPACE_SHARED(rej_uniform)
+
 static unsigned int rej_uniform(int32_t *a, unsigned int target,
                                 unsigned int offset, const uint8_t *buf,
                                 unsigned int buflen);
@@ -8,7 +8,7 @@ void harness(void)
 {
   uint8_t *c;
   uint8_t *sig;
-  polyveck *h;
+  uint8_t *h;
   polyvecl *z;
   int r;
   r = unpack_sig(c, z, h, sig);
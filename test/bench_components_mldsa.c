@@ -10,54 +10,149 @@
 #include <string.h>
 #include "../mldsa/ntt.h"
 #include "../mldsa/poly.h"
+#include "../mldsa/poly_kl.h"
+#include "../mldsa/polyvec.h"
 #include "../mldsa/randombytes.h"
 #include "hal.h"
 
 #define NWARMUP 50
 #define NITERATIONS 300
 #define NTESTS 20
+/* Number of individually timed calls in cold-cache mode */
+#define NTESTS_COLD 200
+
+/* If set, additionally time each component with cold caches */
+static int cold;
 
 static int cmp_uint64_t(const void *a, const void *b)
 {
   return (int)((*((const uint64_t *)a)) - (*((const uint64_t *)b)));
 }
 
-#define BENCH(txt, code)                                \
-  for (i = 0; i < NTESTS; i++)                          \
-  {                                                     \
-    randombytes((uint8_t *)data0, sizeof(data0));       \
-    for (j = 0; j < NWARMUP; j++)                       \
-    {                                                   \
-      code;                                             \
-    }                                                   \
-                                                        \
-    t0 = get_cyclecounter();                            \
-    for (j = 0; j < NITERATIONS; j++)                   \
-    {                                                   \
-      code;                                             \
-    }                                                   \
-    t1 = get_cyclecounter();                            \
-    (cyc)[i] = t1 - t0;                                 \
-  }                                                     \
-  qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t); \
-  printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERATIONS);
+/* Fill p with coefficients in [0, bound) */
+static void poly_random(poly *p, int32_t bound)
+{
+  unsigned k;
+
+  randombytes((uint8_t *)p->coeffs, sizeof(p->coeffs));
+  for (k = 0; k < MLDSA_N; k++)
+  {
+    p->coeffs[k] = (int32_t)((uint32_t)p->coeffs[k] % (uint32_t)bound);
+  }
+}
+
+/* init runs before each sample and must put all inputs of code into the
+ * range its function requires. Repeated calls of code must stay in that
+ * range, too. */
+#define BENCH(txt, init, code)                                              \
+  for (i = 0; i < NTESTS; i++)                                              \
+  {                                                                         \
+    init;                                                                   \
+    for (j = 0; j < NWARMUP; j++)                                           \
+    {                                                                       \
+      code;                                                                 \
+    }                                                                       \
+                                                                            \
+    t0 = get_cyclecounter();                                                \
+    for (j = 0; j < NITERATIONS; j++)                                       \
+    {                                                                       \
+      code;                                                                 \
+    }                                                                       \
+    t1 = get_cyclecounter();                                                \
+    (cyc)[i] = t1 - t0;                                                     \
+  }                                                                         \
+  qsort((cyc), NTESTS, sizeof(uint64_t), cmp_uint64_t);                     \
+  printf(txt " cycles=%" PRIu64 "\n", (cyc)[NTESTS >> 1] / NITERATIONS);    \
+  if (cold)                                                                 \
+  {                                                                         \
+    for (i = 0; i < NTESTS_COLD; i++)                                       \
+    {                                                                       \
+      init;                                                                 \
+      evict_caches();                                                       \
+      t0 = get_cyclecounter();                                              \
+      code;                                                                 \
+      t1 = get_cyclecounter();                                              \
+      (cyc_cold)[i] = t1 - t0;                                              \
+    }                                                                       \
+    qsort((cyc_cold), NTESTS_COLD, sizeof(uint64_t), cmp_uint64_t);         \
+    printf(txt " cold cycles=%" PRIu64 "\n", (cyc_cold)[NTESTS_COLD >> 1]); \
+  }
 
 static int bench(void)
 {
-  int32_t data0[256];
+  poly data0, data1, data2, src;
+  polyvecl vec1, vec2, vsrc, vdata;
+  polyvecl mat[MLDSA_K];
+  uint8_t rho[MLDSA_SEEDBYTES];
   uint64_t cyc[NTESTS];
+  uint64_t cyc_cold[NTESTS_COLD];
   unsigned i, j;
   uint64_t t0, t1;
 
+  poly_random(&data0, MLDSA_Q);
+  poly_random(&data1, MLDSA_Q);
+  poly_random(&data2, MLDSA_Q);
+  for (i = 0; i < MLDSA_L; i++)
+  {
+    poly_random(&vec1.vec[i], MLDSA_Q);
+    poly_random(&vec2.vec[i], MLDSA_Q);
+    poly_random(&vsrc.vec[i], MLDSA_Q);
+  }
+
   /* ntt */
-  BENCH("poly_ntt", poly_ntt((poly *)data0))
-  BENCH("poly_invntt_tomont", poly_invntt_tomont((poly *)data0))
+  /* The output of poly_ntt is not a valid input to it, so every call
+   * transforms a fresh copy of src. The copy is part of the figure; see
+   * poly_copy below. */
+  BENCH("poly_copy", poly_random(&src, MLDSA_Q), data0 = src)
+  BENCH("poly_ntt", poly_random(&src, MLDSA_Q),
+        (data0 = src, poly_ntt(&data0)))
+  BENCH("poly_invntt_tomont", poly_random(&data0, MLDSA_Q),
+        poly_invntt_tomont(&data0))
+  /* As above, for a whole vector in one call */
+  BENCH("polyvecl_ntt", poly_random(&vsrc.vec[0], MLDSA_Q),
+        (vdata = vsrc, polyvecl_ntt(&vdata)))
+  BENCH("polyvecl_invntt_tomont", vdata = vsrc,
+        polyvecl_invntt_tomont(&vdata))
+
+  /* pointwise multiplication */
+  BENCH("poly_pointwise_montgomery", poly_random(&data0, MLDSA_Q),
+        poly_pointwise_montgomery(&data0, &data1, &data2))
+  BENCH("polyvecl_pointwise_acc_montgomery", poly_random(&data0, MLDSA_Q),
+        polyvecl_pointwise_acc_montgomery(&data0, &vec1, &vec2))
+
+  /* coefficient-wise arithmetic */
+  BENCH("poly_reduce", poly_random(&data0, MLDSA_Q), poly_reduce(&data0))
+  BENCH("poly_caddq", poly_random(&data0, MLDSA_Q), poly_caddq(&data0))
+  /* As for poly_ntt, with inputs in the range of t1 */
+  BENCH("poly_shiftl", poly_random(&src, 1 << 10),
+        (data0 = src, poly_shiftl(&data0)))
+  BENCH("poly_power2round", poly_random(&data0, MLDSA_Q),
+        poly_power2round(&data1, &data2, &data0))
+  BENCH("poly_add", poly_random(&data0, MLDSA_Q),
+        poly_add(&data0, &data1, &data2))
+  BENCH("poly_sub", poly_random(&data0, MLDSA_Q),
+        poly_sub(&data0, &data1, &data2))
+
+  /* matrix expansion; with -DMLD_CONFIG_CUSTOM_CAPABILITY_FUNC, this
+   * times the path for hosts without the 8-way Keccak backend */
+  BENCH("polyvec_matrix_expand", randombytes(rho, sizeof(rho)),
+        polyvec_matrix_expand(mat, rho))
 
   return 0;
 }
 
-int main(void)
+int main(int argc, char *argv[])
 {
+  if (argc > 1 && strcmp(argv[1], "--cold") == 0)
+  {
+    cold = 1;
+  }
+  else if (argc > 1)
+  {
+    fprintf(stderr, "Usage: %s [--cold]\n", argv[0]);
+    return 1;
+  }
+
   enable_cyclecounter();
   bench();
   disable_cyclecounter();
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Multi-threaded load generator.
+ *
+ * Runs a mix of key generation, signing and verification on a number of
+ * threads, over a pool of keys and with message lengths drawn from a
+ * weighted distribution, and reports throughput and latency percentiles
+ * per operation. Timing uses the monotonic wall clock, so no cycle
+ * counter setup is required.
+ *
+ * The internal APIs are used with seeds and signing randomness derived
+ * from a per-thread PRNG: the test RNG behind randombytes() is not
+ * thread-safe. Runs are hence reproducible for a fixed configuration. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../mldsa/sign.h"
+#include "../mldsa/verify_cache.h"
+
+#define CTXLEN 1
+#define MAX_SIZES 16
+
+enum
+{
+  OP_KEYPAIR,
+  OP_SIGN,
+  OP_VERIFY,
+  NUM_OPS
+};
+
+static const char *const op_names[NUM_OPS] = {"keypair", "sign", "verify"};
+
+/* Configuration, set from the command line */
+static unsigned nthreads = 1;
+static unsigned nkeys = 16;
+static unsigned nops = 1000;
+static size_t stack_size = 0;
+static unsigned mix[NUM_OPS] = {1, 10, 89};
+static size_t sizes[MAX_SIZES] = {32};
+static unsigned size_weights[MAX_SIZES] = {1};
+static unsigned nsizes = 1;
+
+/* Shared read-only state */
+static uint8_t (*pks)[CRYPTO_PUBLICKEYBYTES];
+static uint8_t (*sks)[CRYPTO_SECRETKEYBYTES];
+/* sigs[k * nsizes + s]: signature under key k of the first sizes[s]
+ * bytes of msg */
+static uint8_t (*sigs)[CRYPTO_BYTES];
+static uint8_t *msg;
+static uint8_t pre[CTXLEN + 2];
+
+typedef struct
+{
+  pthread_t thread;
+  uint64_t rng;
+  /* Latencies in nanoseconds, per operation */
+  uint64_t *lat[NUM_OPS];
+  unsigned count[NUM_OPS];
+  int ret;
+} worker;
+
+/* splitmix64 */
+static uint64_t next_rand(uint64_t *state)
+{
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+static void fill_rand(uint64_t *state, uint8_t *buf, size_t len)
+{
+  size_t i;
+  uint64_t r = 0;
+  for (i = 0; i < len; i++)
+  {
+    if ((i & 7) == 0)
+    {
+      r = next_rand(state);
+    }
+    buf[i] = (uint8_t)(r >> (8 * (i & 7)));
+  }
+}
+
+/* Pick an index with probability proportional to its weight */
+static unsigned pick(uint64_t *state, const unsigned *weights, unsigned n)
+{
+  unsigned i, total = 0, r;
+  for (i = 0; i < n; i++)
+  {
+    total += weights[i];
+  }
+  r = (unsigned)(next_rand(state) % total);
+  for (i = 0; i < n - 1; i++)
+  {
+    if (r < weights[i])
+    {
+      break;
+    }
+    r -= weights[i];
+  }
+  return i;
+}
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void *run_worker(void *arg)
+{
+  worker *w = (worker *)arg;
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t seed[MLDSA_SEEDBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  size_t siglen;
+  unsigned i, op, k, s;
+  uint64_t t0, t1;
+
+  for (i = 0; i < nops; i++)
+  {
+    op = pick(&w->rng, mix, NUM_OPS);
+    k = (unsigned)(next_rand(&w->rng) % nkeys);
+    s = pick(&w->rng, size_weights, nsizes);
+
+    switch (op)
+    {
+      case OP_KEYPAIR:
+        fill_rand(&w->rng, seed, sizeof(seed));
+        t0 = now_ns();
+        w->ret |= crypto_sign_keypair_internal(pk, sk, seed);
+        t1 = now_ns();
+        break;
+      case OP_SIGN:
+        fill_rand(&w->rng, rnd, sizeof(rnd));
+        t0 = now_ns();
+        w->ret |= crypto_sign_signature_internal(
+            sig, &siglen, msg, sizes[s], pre, sizeof(pre), rnd, sks[k], 0);
+        t1 = now_ns();
+        break;
+      default:
+        t0 = now_ns();
+        w->ret |=
+            crypto_sign_verify_internal(sigs[k * nsizes + s], CRYPTO_BYTES,
+                                        msg, sizes[s], pre, sizeof(pre),
+                                        pks[k], 0);
+        t1 = now_ns();
+        break;
+    }
+    w->lat[op][w->count[op]++] = t1 - t0;
+  }
+  return NULL;
+}
+
+static int cmp_uint64_t(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static double percentile(const uint64_t *sorted, size_t n, double p)
+{
+  size_t idx = (size_t)(p / 100 * (double)(n - 1) + 0.5);
+  return (double)sorted[idx] / 1000;
+}
+
+/* Parse a comma-separated list of `size:weight` pairs */
+static int parse_sizes(char *arg)
+{
+  char *tok;
+  unsigned total = 0;
+  nsizes = 0;
+  for (tok = strtok(arg, ","); tok != NULL; tok = strtok(NULL, ","))
+  {
+    char *colon = strchr(tok, ':');
+    if (nsizes == MAX_SIZES)
+    {
+      return -1;
+    }
+    sizes[nsizes] = (size_t)strtoul(tok, NULL, 0);
+    size_weights[nsizes] = colon ? (unsigned)strtoul(colon + 1, NULL, 0) : 1;
+    total += size_weights[nsizes];
+    nsizes++;
+  }
+  /* pick() needs a nonzero total weight */
+  return total == 0 ? -1 : 0;
+}
+
+static int parse_mix(const char *arg)
+{
+  if (sscanf(arg, "%u:%u:%u", &mix[OP_KEYPAIR], &mix[OP_SIGN],
+             &mix[OP_VERIFY]) != 3)
+  {
+    return -1;
+  }
+  return mix[OP_KEYPAIR] + mix[OP_SIGN] + mix[OP_VERIFY] == 0 ? -1 : 0;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr,
+          "Usage: %s [-t threads] [-k keys] [-n ops per thread]\n"
+          "          [-x keypair:sign:verify] [-m size:weight,...]\n"
+          "          [-S thread stack size]\n"
+          "Defaults: -t 1 -k 16 -n 1000 -x 1:10:89 -m 32:1\n",
+          prog);
+}
+
+int main(int argc, char *argv[])
+{
+  worker *workers;
+  pthread_attr_t attr;
+  uint64_t seed_rng = 0x6d6c6473612d6c64ULL;
+  uint8_t seed[MLDSA_SEEDBYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  size_t siglen, max_size = 0;
+  unsigned i, j, k, s, op;
+  uint64_t t0, t1;
+  int c, ret = 0;
+
+  while ((c = getopt(argc, argv, "t:k:n:x:m:S:")) != -1)
+  {
+    switch (c)
+    {
+      case 't':
+        nthreads = (unsigned)strtoul(optarg, NULL, 0);
+        break;
+      case 'k':
+        nkeys = (unsigned)strtoul(optarg, NULL, 0);
+        break;
+      case 'n':
+        nops = (unsigned)strtoul(optarg, NULL, 0);
+        break;
+      case 'x':
+        if (parse_mix(optarg) != 0)
+        {
+          usage(argv[0]);
+          return 1;
+        }
+        break;
+      case 'm':
+        if (parse_sizes(optarg) != 0)
+        {
+          usage(argv[0]);
+          return 1;
+        }
+        break;
+      case 'S':
+        stack_size = (size_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+  if (nthreads == 0 || nkeys == 0 || nops == 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  for (s = 0; s < nsizes; s++)
+  {
+    max_size = sizes[s] > max_size ? sizes[s] : max_size;
+  }
+
+  pks = malloc(nkeys * sizeof(*pks));
+  sks = malloc(nkeys * sizeof(*sks));
+  sigs = malloc((size_t)nkeys * nsizes * sizeof(*sigs));
+  msg = malloc(max_size + 1);
+  workers = calloc(nthreads, sizeof(worker));
+  if (pks == NULL || sks == NULL || sigs == NULL || msg == NULL ||
+      workers == NULL)
+  {
+    fprintf(stderr, "ERROR: out of memory\n");
+    return 1;
+  }
+
+  /* Set up keys, message and signatures for verification */
+  pre[0] = 0;
+  pre[1] = CTXLEN;
+  fill_rand(&seed_rng, pre + 2, CTXLEN);
+  fill_rand(&seed_rng, msg, max_size);
+  for (k = 0; k < nkeys; k++)
+  {
+    fill_rand(&seed_rng, seed, sizeof(seed));
+    ret |= crypto_sign_keypair_internal(pks[k], sks[k], seed);
+    for (s = 0; s < nsizes; s++)
+    {
+      fill_rand(&seed_rng, rnd, sizeof(rnd));
+      ret |= crypto_sign_signature_internal(sigs[k * nsizes + s], &siglen,
+                                            msg, sizes[s], pre, sizeof(pre),
+                                            rnd, sks[k], 0);
+    }
+  }
+
+  for (i = 0; i < nthreads; i++)
+  {
+    workers[i].rng = next_rand(&seed_rng);
+    for (op = 0; op < NUM_OPS; op++)
+    {
+      workers[i].lat[op] = malloc(nops * sizeof(uint64_t));
+      if (workers[i].lat[op] == NULL)
+      {
+        fprintf(stderr, "ERROR: out of memory\n");
+        return 1;
+      }
+    }
+  }
+
+  pthread_attr_init(&attr);
+  if (stack_size != 0 && pthread_attr_setstacksize(&attr, stack_size) != 0)
+  {
+    fprintf(stderr, "ERROR: invalid stack size %zu\n", stack_size);
+    return 1;
+  }
+
+  t0 = now_ns();
+  for (i = 0; i < nthreads; i++)
+  {
+    if (pthread_create(&workers[i].thread, &attr, run_worker, &workers[i]) !=
+        0)
+    {
+      fprintf(stderr, "ERROR: pthread_create failed\n");
+      return 1;
+    }
+  }
+  for (i = 0; i < nthreads; i++)
+  {
+    pthread_join(workers[i].thread, NULL);
+    ret |= workers[i].ret;
+  }
+  t1 = now_ns();
+  pthread_attr_destroy(&attr);
+
+  printf("threads %u, keys %u, ops %u, elapsed %.3f s, throughput %.1f ops/s\n",
+         nthreads, nkeys, nthreads * nops, (double)(t1 - t0) / 1e9,
+         (double)nthreads * nops * 1e9 / (double)(t1 - t0));
+  printf("%10s %10s %12s %10s %10s %10s\n", "op", "count", "ops/s", "p50 us",
+         "p99 us", "p99.9 us");
+  for (op = 0; op < NUM_OPS; op++)
+  {
+    uint64_t *all;
+    size_t n = 0;
+    for (i = 0; i < nthreads; i++)
+    {
+      n += workers[i].count[op];
+    }
+    if (n == 0)
+    {
+      continue;
+    }
+    all = malloc(n * sizeof(uint64_t));
+    if (all == NULL)
+    {
+      fprintf(stderr, "ERROR: out of memory\n");
+      return 1;
+    }
+    n = 0;
+    for (i = 0; i < nthreads; i++)
+    {
+      for (j = 0; j < workers[i].count[op]; j++)
+      {
+        all[n++] = workers[i].lat[op][j];
+      }
+    }
+    qsort(all, n, sizeof(uint64_t), cmp_uint64_t);
+    printf("%10s %10zu %12.1f %10.1f %10.1f %10.1f\n", op_names[op], n,
+           (double)n * 1e9 / (double)(t1 - t0), percentile(all, n, 50),
+           percentile(all, n, 99), percentile(all, n, 99.9));
+    free(all);
+  }
+
+#if defined(MLD_CONFIG_VERIFY_CACHE)
+  {
+    uint64_t hits, misses;
+    crypto_sign_verify_cache_stats(&hits, &misses);
+    printf("verify cache: %" PRIu64 " hits, %" PRIu64 " misses\n", hits,
+           misses);
+  }
+#endif
+
+  for (i = 0; i < nthreads; i++)
+  {
+    for (op = 0; op < NUM_OPS; op++)
+    {
+      free(workers[i].lat[op]);
+    }
+  }
+  free(workers);
+  free(msg);
+  free(sigs);
+  free(sks);
+  free(pks);
+
+  if (ret != 0)
+  {
+    fprintf(stderr, "ERROR: signing or verification failed\n");
+    return 1;
+  }
+  return 0;
+}
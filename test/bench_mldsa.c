@@ -10,6 +10,8 @@
 #include <string.h>
 #include "../mldsa/randombytes.h"
 #include "../mldsa/sign.h"
+#include "../mldsa/stats.h"
+#include "../mldsa/trace.h"
 #include "hal.h"
 
 #define NWARMUP 10
@@ -17,6 +19,10 @@
 #define NTESTS 250
 #define MLEN 59
 #define CTXLEN 1
+/* Number of distinct keys rotated through in cold-cache mode */
+#define NKEYS 64
+/* Number of key pairs per crypto_sign_keypair_batch_internal() call */
+#define NBATCH 4
 
 #define CHECK(x)                                              \
   do                                                          \
@@ -35,9 +41,10 @@ static int cmp_uint64_t(const void *a, const void *b)
   return (int)((*((const uint64_t *)a)) - (*((const uint64_t *)b)));
 }
 
-static void print_median(const char *txt, uint64_t cyc[NTESTS])
+static void print_median(const char *txt, uint64_t cyc[NTESTS],
+                         unsigned niterations)
 {
-  printf("%10s cycles = %" PRIu64 "\n", txt, cyc[NTESTS >> 1] / NITERATIONS);
+  printf("%10s cycles = %" PRIu64 "\n", txt, cyc[NTESTS >> 1] / niterations);
 }
 
 static int percentiles[] = {1, 10, 20, 30, 40, 50, 60, 70, 80, 90, 99};
@@ -53,17 +60,22 @@ static void print_percentile_legend(void)
   printf("\n");
 }
 
-static void print_percentiles(const char *txt, uint64_t cyc[NTESTS])
+static void print_percentiles(const char *txt, uint64_t cyc[NTESTS],
+                              unsigned niterations)
 {
   unsigned i;
   printf("%10s percentiles:", txt);
   for (i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
   {
-    printf("%7" PRIu64, (cyc)[NTESTS * percentiles[i] / 100] / NITERATIONS);
+    printf("%7" PRIu64, (cyc)[NTESTS * percentiles[i] / 100] / niterations);
   }
   printf("\n");
 }
 
+static uint8_t batch_pk[NBATCH][CRYPTO_PUBLICKEYBYTES];
+static uint8_t batch_sk[NBATCH][CRYPTO_SECRETKEYBYTES];
+static uint8_t batch_seeds[NBATCH][MLDSA_SEEDBYTES];
+
 static int bench(void)
 {
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
@@ -78,6 +90,7 @@ static int bench(void)
   uint64_t t0, t1;
 
   uint64_t cycles_kg[NTESTS], cycles_sign[NTESTS], cycles_verify[NTESTS];
+  uint64_t cycles_sign_seed[NTESTS], cycles_kg_batch[NTESTS];
   unsigned char pre[CTXLEN + 2];
 
   for (i = 0; i < NTESTS; i++)
@@ -101,6 +114,25 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_kg[i] = t1 - t0;
 
+    /* Batch key-pair generation, reported per key pair */
+    for (j = 0; j < NBATCH; j++)
+    {
+      memcpy(batch_seeds[j], kg_rand, MLDSA_SEEDBYTES);
+    }
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_keypair_batch_internal(batch_pk[0], batch_sk[0],
+                                                batch_seeds[0], NBATCH);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_keypair_batch_internal(batch_pk[0], batch_sk[0],
+                                                batch_seeds[0], NBATCH);
+    }
+    t1 = get_cyclecounter();
+    cycles_kg_batch[i] = t1 - t0;
+
 
     /* Signing */
     randombytes(ctx, CTXLEN);
@@ -126,6 +158,23 @@ static int bench(void)
     t1 = get_cyclecounter();
     cycles_sign[i] = t1 - t0;
 
+    /* Signing from the seed-only secret key */
+    for (j = 0; j < NWARMUP; j++)
+    {
+      ret |= crypto_sign_signature_seed_internal(sig, &siglen, m, MLEN, pre,
+                                                 CTXLEN + 2, sig_rand, kg_rand,
+                                                 0);
+    }
+    t0 = get_cyclecounter();
+    for (j = 0; j < NITERATIONS; j++)
+    {
+      ret |= crypto_sign_signature_seed_internal(sig, &siglen, m, MLEN, pre,
+                                                 CTXLEN + 2, sig_rand, kg_rand,
+                                                 0);
+    }
+    t1 = get_cyclecounter();
+    cycles_sign_seed[i] = t1 - t0;
+
     /* Verification */
     for (j = 0; j < NWARMUP; j++)
     {
@@ -142,29 +191,271 @@ static int bench(void)
     CHECK(ret == 0);
   }
 
+  qsort(cycles_kg, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_kg_batch, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_sign, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_sign_seed, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+  qsort(cycles_verify, NTESTS, sizeof(uint64_t), cmp_uint64_t);
+
+  print_median("keypair", cycles_kg, NITERATIONS);
+  print_median("keypair_batch", cycles_kg_batch, NBATCH * NITERATIONS);
+  print_median("sign", cycles_sign, NITERATIONS);
+  print_median("sign_seed", cycles_sign_seed, NITERATIONS);
+  print_median("verify", cycles_verify, NITERATIONS);
+
+  printf("\n");
+
+  print_percentile_legend();
+
+  print_percentiles("keypair", cycles_kg, NITERATIONS);
+  print_percentiles("keypair_batch", cycles_kg_batch, NBATCH * NITERATIONS);
+  print_percentiles("sign", cycles_sign, NITERATIONS);
+  print_percentiles("sign_seed", cycles_sign_seed, NITERATIONS);
+  print_percentiles("verify", cycles_verify, NITERATIONS);
+
+  return 0;
+}
+
+static uint8_t cold_pk[NKEYS][CRYPTO_PUBLICKEYBYTES];
+static uint8_t cold_sk[NKEYS][CRYPTO_SECRETKEYBYTES];
+static uint8_t cold_sig[NKEYS][CRYPTO_BYTES];
+static uint8_t cold_m[NKEYS][MLEN];
+
+/* Cold-cache benchmark: every operation is timed individually after
+ * evicting the caches, and consecutive operations use different keys,
+ * messages and signatures, as when serving unrelated requests. */
+static int bench_cold(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ctx[CTXLEN];
+  unsigned char kg_rand[MLDSA_SEEDBYTES], sig_rand[MLDSA_SEEDBYTES];
+  unsigned char pre[CTXLEN + 2];
+  size_t siglen;
+  unsigned i, k;
+  uint64_t t0, t1;
+  uint64_t cycles_kg[NTESTS], cycles_sign[NTESTS], cycles_verify[NTESTS];
+  int ret = 0;
+
+  randombytes(ctx, CTXLEN);
+  pre[0] = 0;
+  pre[1] = CTXLEN;
+  memcpy(pre + 2, ctx, CTXLEN);
+
+  for (k = 0; k < NKEYS; k++)
+  {
+    randombytes(kg_rand, sizeof(kg_rand));
+    randombytes(sig_rand, sizeof(sig_rand));
+    randombytes(cold_m[k], MLEN);
+    ret |= crypto_sign_keypair_internal(cold_pk[k], cold_sk[k], kg_rand);
+    ret |= crypto_sign_signature_internal(cold_sig[k], &siglen, cold_m[k],
+                                          MLEN, pre, CTXLEN + 2, sig_rand,
+                                          cold_sk[k], 0);
+  }
+
+  for (i = 0; i < NTESTS; i++)
+  {
+    k = i % NKEYS;
+    randombytes(kg_rand, sizeof(kg_rand));
+    randombytes(sig_rand, sizeof(sig_rand));
+
+    evict_caches();
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_keypair_internal(pk, sk, kg_rand);
+    t1 = get_cyclecounter();
+    cycles_kg[i] = t1 - t0;
+
+    evict_caches();
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_signature_internal(cold_sig[k], &siglen, cold_m[k],
+                                          MLEN, pre, CTXLEN + 2, sig_rand,
+                                          cold_sk[k], 0);
+    t1 = get_cyclecounter();
+    cycles_sign[i] = t1 - t0;
+
+    /* Verify a different key's signature than the one just produced */
+    k = (i + NKEYS / 2) % NKEYS;
+    evict_caches();
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_verify(cold_sig[k], CRYPTO_BYTES, cold_m[k], MLEN, ctx,
+                              CTXLEN, cold_pk[k]);
+    t1 = get_cyclecounter();
+    cycles_verify[i] = t1 - t0;
+  }
+  CHECK(ret == 0);
+
   qsort(cycles_kg, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_sign, NTESTS, sizeof(uint64_t), cmp_uint64_t);
   qsort(cycles_verify, NTESTS, sizeof(uint64_t), cmp_uint64_t);
 
-  print_median("keypair", cycles_kg);
-  print_median("sign", cycles_sign);
-  print_median("verify", cycles_verify);
+  printf("\ncold cache (%d keys):\n", NKEYS);
+  print_median("keypair", cycles_kg, 1);
+  print_median("sign", cycles_sign, 1);
+  print_median("verify", cycles_verify, 1);
 
   printf("\n");
 
   print_percentile_legend();
 
-  print_percentiles("keypair", cycles_kg);
-  print_percentiles("sign", cycles_sign);
-  print_percentiles("verify", cycles_verify);
+  print_percentiles("keypair", cycles_kg, 1);
+  print_percentiles("sign", cycles_sign, 1);
+  print_percentiles("verify", cycles_verify, 1);
 
   return 0;
 }
 
-int main(void)
+#if defined(MLD_CONFIG_TRACE)
+static uint64_t trace_cycles[MLD_TRACE_STAGE_COUNT];
+static uint64_t trace_calls[MLD_TRACE_STAGE_COUNT];
+
+static void trace_record(mld_trace_stage stage, uint64_t cycles)
 {
+  trace_cycles[stage] += cycles;
+  trace_calls[stage]++;
+}
+
+/* Run each operation NTESTS times with tracing enabled and print the
+ * average cycles spent per operation in each stage. This is done in a
+ * separate pass so that the callback overhead does not affect the
+ * figures reported by bench(). */
+static int bench_trace(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  unsigned char kg_rand[MLDSA_SEEDBYTES], sig_rand[MLDSA_SEEDBYTES];
+  unsigned char pre[CTXLEN + 2];
+  size_t siglen;
+  unsigned i;
+  int ret = 0;
+
+  randombytes(ctx, CTXLEN);
+  pre[0] = 0;
+  pre[1] = CTXLEN;
+  memcpy(pre + 2, ctx, CTXLEN);
+
+  mld_trace_register(trace_record, get_cyclecounter);
+  for (i = 0; i < NTESTS; i++)
+  {
+    randombytes(kg_rand, sizeof(kg_rand));
+    randombytes(sig_rand, sizeof(sig_rand));
+    randombytes(m, MLEN);
+    ret |= crypto_sign_keypair_internal(pk, sk, kg_rand);
+    ret |= crypto_sign_signature_internal(sig, &siglen, m, MLEN, pre,
+                                          CTXLEN + 2, sig_rand, sk, 0);
+    ret |= crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  }
+  mld_trace_register(NULL, NULL);
+  CHECK(ret == 0);
+
+  printf("\n%22s %12s %10s\n", "stage", "cycles/op", "calls/op");
+  for (i = 0; i < MLD_TRACE_STAGE_COUNT; i++)
+  {
+    printf("%22s %12" PRIu64 " %10.2f\n",
+           mld_trace_stage_name((mld_trace_stage)i), trace_cycles[i] / NTESTS,
+           (double)trace_calls[i] / NTESTS);
+  }
+
+  return 0;
+}
+#endif /* MLD_CONFIG_TRACE */
+
+#if defined(MLD_CONFIG_STATS)
+static void print_stats(const char *txt, const mld_stats *st, unsigned ops)
+{
+  printf("%10s per op: keccak %6.1f  ntt %6.1f  invntt %6.1f  "
+         "uniform+ %5.2f  uniform_eta+ %5.2f\n",
+         txt, (double)st->keccak_permutations / ops, (double)st->ntts / ops,
+         (double)st->invntts / ops, (double)st->uniform_extra_blocks / ops,
+         (double)st->uniform_eta_extra_blocks / ops);
+}
+
+/* Run each operation NTESTS times and print the operation counters
+ * per call, as well as the histogram of rejections per signature. */
+static int bench_stats(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  unsigned char kg_rand[MLDSA_SEEDBYTES], sig_rand[MLDSA_SEEDBYTES];
+  size_t siglen;
+  mld_stats st;
+  unsigned i;
+  int ret = 0;
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  randombytes(kg_rand, sizeof(kg_rand));
+
+  printf("\n");
+  mld_stats_reset();
+  for (i = 0; i < NTESTS; i++)
+  {
+    ret |= crypto_sign_keypair_internal(pk, sk, kg_rand);
+  }
+  mld_stats_get(&st);
+  print_stats("keypair", &st, NTESTS);
+
+  mld_stats_reset();
+  for (i = 0; i < NTESTS; i++)
+  {
+    randombytes(sig_rand, sizeof(sig_rand));
+    ret |= crypto_sign_signature_internal(sig, &siglen, m, MLEN, ctx, CTXLEN,
+                                          sig_rand, sk, 0);
+  }
+  mld_stats_get(&st);
+  print_stats("sign", &st, NTESTS);
+
+  printf("%10s rejections:", "sign");
+  for (i = 0; i < MLD_STATS_REJ_BUCKETS; i++)
+  {
+    printf(" %" PRIu64, st.rejections[i]);
+  }
+  printf("  (of %" PRIu64 ")\n", st.signatures);
+
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  mld_stats_reset();
+  for (i = 0; i < NTESTS; i++)
+  {
+    ret |= crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  }
+  mld_stats_get(&st);
+  print_stats("verify", &st, NTESTS);
+
+  CHECK(ret == 0);
+  return 0;
+}
+#endif /* MLD_CONFIG_STATS */
+
+int main(int argc, char *argv[])
+{
+  int cold = 0;
+  if (argc > 1 && strcmp(argv[1], "--cold") == 0)
+  {
+    cold = 1;
+  }
+  else if (argc > 1)
+  {
+    fprintf(stderr, "Usage: %s [--cold]\n", argv[0]);
+    return 1;
+  }
+
   enable_cyclecounter();
   bench();
+  if (cold)
+  {
+    bench_cold();
+  }
+#if defined(MLD_CONFIG_TRACE)
+  bench_trace();
+#endif
+#if defined(MLD_CONFIG_STATS)
+  bench_stats();
+#endif
   disable_cyclecounter();
 
   return 0;
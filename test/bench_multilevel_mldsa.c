@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Benchmark a process serving all three parameter sets, linked against
+ * libmldsa.a.
+ *
+ * The operations are first run one parameter set at a time, and then
+ * interleaved round-robin across the parameter sets, as e.g. a server
+ * verifying signatures of all levels would. The difference between both
+ * shows the cost of the parameter sets competing for the instruction
+ * cache and branch predictors. */
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../mldsa/api.h"
+#include "../mldsa/randombytes.h"
+#include "hal.h"
+
+#define NWARMUP 10
+#define NTESTS 101
+#define MLEN 59
+#define CTXLEN 1
+#define NLEVELS 3
+
+#define MAX_PUBLICKEYBYTES MLD_87_PUBLICKEYBYTES
+#define MAX_SECRETKEYBYTES MLD_87_SECRETKEYBYTES
+#define MAX_BYTES MLD_87_BYTES
+
+struct level
+{
+  const char *name;
+  int (*keypair)(uint8_t *pk, uint8_t *sk);
+  int (*signature)(uint8_t *sig, size_t *siglen, const uint8_t *m, size_t mlen,
+                   const uint8_t *ctx, size_t ctxlen, const uint8_t *sk);
+  int (*verify)(const uint8_t *sig, size_t siglen, const uint8_t *m,
+                size_t mlen, const uint8_t *ctx, size_t ctxlen,
+                const uint8_t *pk);
+};
+
+static const struct level levels[NLEVELS] = {
+    {"ML-DSA-44", MLD_44_ref_keypair, MLD_44_ref_signature, MLD_44_ref_verify},
+    {"ML-DSA-65", MLD_65_ref_keypair, MLD_65_ref_signature, MLD_65_ref_verify},
+    {"ML-DSA-87", MLD_87_ref_keypair, MLD_87_ref_signature, MLD_87_ref_verify},
+};
+
+static uint8_t pk[NLEVELS][MAX_PUBLICKEYBYTES];
+static uint8_t sk[NLEVELS][MAX_SECRETKEYBYTES];
+static uint8_t sig[NLEVELS][MAX_BYTES];
+static size_t siglen[NLEVELS];
+static uint8_t m[MLEN];
+static uint8_t ctx[CTXLEN];
+
+static uint64_t cycles_kg[NLEVELS][NTESTS];
+static uint64_t cycles_sign[NLEVELS][NTESTS];
+static uint64_t cycles_verify[NLEVELS][NTESTS];
+
+static int cmp_uint64_t(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+/* Run and time one keypair, sign and verify operation of level l */
+static int run(unsigned l, unsigned i)
+{
+  const struct level *lvl = &levels[l];
+  uint64_t t0, t1;
+  int ret = 0;
+
+  t0 = get_cyclecounter();
+  ret |= lvl->keypair(pk[l], sk[l]);
+  t1 = get_cyclecounter();
+  cycles_kg[l][i] = t1 - t0;
+
+  t0 = get_cyclecounter();
+  ret |= lvl->signature(sig[l], &siglen[l], m, MLEN, ctx, CTXLEN, sk[l]);
+  t1 = get_cyclecounter();
+  cycles_sign[l][i] = t1 - t0;
+
+  t0 = get_cyclecounter();
+  ret |= lvl->verify(sig[l], siglen[l], m, MLEN, ctx, CTXLEN, pk[l]);
+  t1 = get_cyclecounter();
+  cycles_verify[l][i] = t1 - t0;
+
+  return ret;
+}
+
+static void print_medians(const char *order)
+{
+  unsigned l;
+  printf("%-12s %-10s %12s %12s %12s\n", order, "scheme", "keypair", "sign",
+         "verify");
+  for (l = 0; l < NLEVELS; l++)
+  {
+    qsort(cycles_kg[l], NTESTS, sizeof(uint64_t), cmp_uint64_t);
+    qsort(cycles_sign[l], NTESTS, sizeof(uint64_t), cmp_uint64_t);
+    qsort(cycles_verify[l], NTESTS, sizeof(uint64_t), cmp_uint64_t);
+    printf("%-12s %-10s %12" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n", "",
+           levels[l].name, cycles_kg[l][NTESTS >> 1],
+           cycles_sign[l][NTESTS >> 1], cycles_verify[l][NTESTS >> 1]);
+  }
+}
+
+static int bench(void)
+{
+  unsigned i, l;
+  int ret = 0;
+
+  randombytes(m, MLEN);
+  randombytes(ctx, CTXLEN);
+
+  for (l = 0; l < NLEVELS; l++)
+  {
+    for (i = 0; i < NWARMUP; i++)
+    {
+      ret |= run(l, 0);
+    }
+  }
+
+  /* One parameter set at a time */
+  for (l = 0; l < NLEVELS; l++)
+  {
+    for (i = 0; i < NTESTS; i++)
+    {
+      ret |= run(l, i);
+    }
+  }
+  print_medians("sequential");
+
+  /* Round-robin across parameter sets */
+  for (i = 0; i < NTESTS; i++)
+  {
+    for (l = 0; l < NLEVELS; l++)
+    {
+      ret |= run(l, i);
+    }
+  }
+  print_medians("interleaved");
+
+  if (ret != 0)
+  {
+    fprintf(stderr, "ERROR: signing or verification failed\n");
+    return 1;
+  }
+  return 0;
+}
+
+int main(void)
+{
+  int ret;
+  enable_cyclecounter();
+  ret = bench();
+  disable_cyclecounter();
+
+  return ret;
+}
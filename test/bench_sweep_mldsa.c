@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Benchmark signing and verification across message and context lengths.
+ *
+ * For each message length, the median cycle count of crypto_sign_signature
+ * and crypto_sign_verify is reported. A least-squares fit over all message
+ * lengths gives the per-byte cost of hashing the message into mu, and the
+ * median at mlen = 0 gives the fixed cost of each operation. The context
+ * length sweep is done at a fixed message length. */
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../mldsa/randombytes.h"
+#include "../mldsa/sign.h"
+#include "hal.h"
+
+#define MAX_MLEN (16u * 1024u * 1024u)
+/* Number of runs per data point, for small and large messages.
+ * Signing needs many runs as the rejection loop makes it noisy. */
+#define NTESTS_SMALL 101
+#define NTESTS_LARGE 11
+#define NWARMUP 10
+#define LARGE_MLEN (64u * 1024u)
+#define CTX_MLEN 32
+
+static const size_t mlens[] = {0,     32,     64,      256,     1024,     4096,
+                               16384, 65536, 262144, 1048576, 4194304, 16777216};
+
+static const size_t ctxlens[] = {0, 1, 16, 64, 128, 255};
+
+#define NMLENS (sizeof(mlens) / sizeof(mlens[0]))
+#define NCTXLENS (sizeof(ctxlens) / sizeof(ctxlens[0]))
+
+static int cmp_uint64_t(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static uint64_t cyc[NTESTS_SMALL];
+
+/* Median cycles of signing and verifying an mlen-byte message with a
+ * ctxlen-byte context */
+static int bench_point(uint64_t *sign_cyc, uint64_t *verify_cyc,
+                       const uint8_t *m, size_t mlen, const uint8_t *ctx,
+                       size_t ctxlen, const uint8_t *pk, const uint8_t *sk)
+{
+  uint8_t sig[CRYPTO_BYTES];
+  size_t siglen;
+  unsigned i, ntests;
+  uint64_t t0, t1;
+  int ret = 0;
+
+  ntests = mlen > LARGE_MLEN ? NTESTS_LARGE : NTESTS_SMALL;
+
+  for (i = 0; i < NWARMUP; i++)
+  {
+    ret |= crypto_sign_signature(sig, &siglen, m, mlen, ctx, ctxlen, sk);
+    ret |= crypto_sign_verify(sig, siglen, m, mlen, ctx, ctxlen, pk);
+  }
+
+  for (i = 0; i < ntests; i++)
+  {
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_signature(sig, &siglen, m, mlen, ctx, ctxlen, sk);
+    t1 = get_cyclecounter();
+    cyc[i] = t1 - t0;
+  }
+  qsort(cyc, ntests, sizeof(uint64_t), cmp_uint64_t);
+  *sign_cyc = cyc[ntests >> 1];
+
+  for (i = 0; i < ntests; i++)
+  {
+    t0 = get_cyclecounter();
+    ret |= crypto_sign_verify(sig, siglen, m, mlen, ctx, ctxlen, pk);
+    t1 = get_cyclecounter();
+    cyc[i] = t1 - t0;
+  }
+  qsort(cyc, ntests, sizeof(uint64_t), cmp_uint64_t);
+  *verify_cyc = cyc[ntests >> 1];
+
+  return ret;
+}
+
+/* Least-squares slope of y against x */
+static double slope(const uint64_t *y)
+{
+  unsigned i;
+  double mx = 0, my = 0, sxy = 0, sxx = 0;
+  for (i = 0; i < NMLENS; i++)
+  {
+    mx += (double)mlens[i];
+    my += (double)y[i];
+  }
+  mx /= NMLENS;
+  my /= NMLENS;
+  for (i = 0; i < NMLENS; i++)
+  {
+    sxy += ((double)mlens[i] - mx) * ((double)y[i] - my);
+    sxx += ((double)mlens[i] - mx) * ((double)mlens[i] - mx);
+  }
+  return sxy / sxx;
+}
+
+static int bench(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t ctx[255];
+  uint8_t *m;
+  uint64_t sign_cyc[NMLENS], verify_cyc[NMLENS];
+  uint64_t s, v;
+  unsigned i;
+  int ret = 0;
+
+  m = malloc(MAX_MLEN);
+  if (m == NULL)
+  {
+    fprintf(stderr, "ERROR: out of memory\n");
+    return 1;
+  }
+  randombytes(m, MAX_MLEN);
+  randombytes(ctx, sizeof(ctx));
+  ret |= crypto_sign_keypair(pk, sk);
+
+  printf("%10s %7s %14s %14s\n", "mlen", "ctxlen", "sign cycles",
+         "verify cycles");
+  for (i = 0; i < NMLENS; i++)
+  {
+    ret |= bench_point(&sign_cyc[i], &verify_cyc[i], m, mlens[i], ctx, 0, pk,
+                       sk);
+    printf("%10zu %7d %14" PRIu64 " %14" PRIu64 "\n", mlens[i], 0, sign_cyc[i],
+           verify_cyc[i]);
+  }
+
+  printf("\n");
+  for (i = 0; i < NCTXLENS; i++)
+  {
+    ret |= bench_point(&s, &v, m, CTX_MLEN, ctx, ctxlens[i], pk, sk);
+    printf("%10d %7zu %14" PRIu64 " %14" PRIu64 "\n", CTX_MLEN, ctxlens[i], s,
+           v);
+  }
+
+  printf("\n%10s %14s %14s\n", "", "sign", "verify");
+  printf("%10s %14" PRIu64 " %14" PRIu64 "\n", "fixed", sign_cyc[0],
+         verify_cyc[0]);
+  printf("%10s %14.2f %14.2f\n", "per byte", slope(sign_cyc),
+         slope(verify_cyc));
+
+  free(m);
+  if (ret != 0)
+  {
+    fprintf(stderr, "ERROR: signing or verification failed\n");
+    return 1;
+  }
+  return 0;
+}
+
+int main(void)
+{
+  int ret;
+  enable_cyclecounter();
+  ret = bench();
+  disable_cyclecounter();
+
+  return ret;
+}
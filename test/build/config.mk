@@ -0,0 +1,11 @@
+# These variables are retained and can't be changed without a clean
+CROSS_PREFIX := 
+LAST_CROSS_PREFIX := 
+CYCLES := NO
+LAST_CYCLES := NO
+OPT := 1
+LAST_OPT := 1
+AUTO := 1
+LAST_AUTO := 1
+SCU := 0
+LAST_SCU := 0
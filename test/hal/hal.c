@@ -304,3 +304,25 @@ void disable_cyclecounter(void) { return; }
 uint64_t get_cyclecounter(void) { return (0); }
 
 #endif
+
+/* Size of the buffer swept by evict_caches(). This should comfortably
+ * exceed the size of the last-level cache of the benchmarked system. */
+#if !defined(HAL_EVICT_BYTES)
+#define HAL_EVICT_BYTES (64u * 1024u * 1024u)
+#endif
+#define HAL_EVICT_STRIDE 64u
+
+static unsigned char evict_buf[HAL_EVICT_BYTES];
+
+void evict_caches(void)
+{
+  unsigned i;
+  /* Read-modify-write each cache line so that it is allocated in all
+   * levels and previously cached lines are evicted. The volatile access
+   * prevents the compiler from removing the sweep. */
+  volatile unsigned char *p = evict_buf;
+  for (i = 0; i < HAL_EVICT_BYTES; i += HAL_EVICT_STRIDE)
+  {
+    p[i] = (unsigned char)(p[i] + 1);
+  }
+}
@@ -32,4 +32,8 @@ void enable_cyclecounter(void);
 void disable_cyclecounter(void);
 uint64_t get_cyclecounter(void);
 
+/* Evict the caches by sweeping over a buffer larger than the
+ * last-level cache. Used by the cold-cache benchmark mode. */
+void evict_caches(void);
+
 #endif
@@ -1,12 +1,27 @@
 # SPDX-License-Identifier: Apache-2.0
 
 FIPS202_SRCS = $(wildcard mldsa/fips202/*.c)
-SOURCES += $(wildcard mldsa/*.c)
+SOURCES += $(filter-out mldsa/mldsa_native.c,$(wildcard mldsa/*.c))
 ifeq ($(OPT),1)
-	SOURCES += $(wildcard mldsa/native/aarch64/src/*.[csS]) $(wildcard mldsa/native/x86_64/src/*.[csS])
+	SOURCES += $(wildcard mldsa/native/aarch64/src/*.[csS]) $(wildcard mldsa/native/aarch64_sve2/src/*.[csS]) $(wildcard mldsa/native/x86_64/src/*.[csS]) \
+		$(wildcard mldsa/fips202/native/x86_64/src/*.[csS])
 	CFLAGS += -DMLD_CONFIG_USE_NATIVE_BACKEND_ARITH -DMLD_CONFIG_USE_NATIVE_BACKEND_FIPS202
 endif
-ALL_TESTS = test_mldsa acvp_mldsa bench_mldsa bench_components_mldsa gen_NISTKAT gen_KAT
+
+# Sources which do not depend on the parameter set; see SHARED_FILES in
+# scripts/autogen. They are built for every parameter set, but only
+# linked once into libmldsa.a.
+SHARED_SOURCES = $(FIPS202_SRCS) $(filter mldsa/native/% mldsa/fips202/native/%,$(SOURCES)) \
+	$(addprefix mldsa/,debug.c ntt.c poly.c stats.c symmetric-shake.c sys.c trace.c)
+
+# SCU=1: build each library from the single compilation unit
+# mldsa/mldsa_native.c instead of the individual C sources. Assembly
+# files are still assembled separately.
+ifeq ($(SCU),1)
+	SOURCES := mldsa/mldsa_native.c $(filter %.S,$(SOURCES))
+	FIPS202_SRCS :=
+endif
+ALL_TESTS = test_mldsa acvp_mldsa bench_mldsa bench_components_mldsa bench_icount_mldsa bench_sweep_mldsa bench_load_mldsa gen_NISTKAT gen_KAT
 NON_NIST_TESTS = $(filter-out gen_NISTKAT,$(ALL_TESTS))
 
 MLDSA44_DIR = $(BUILD_DIR)/mldsa44
@@ -24,7 +39,17 @@ $(BUILD_DIR)/libmldsa44.a: $(MLDSA44_OBJS)
 $(BUILD_DIR)/libmldsa65.a: $(MLDSA65_OBJS)
 $(BUILD_DIR)/libmldsa87.a: $(MLDSA87_OBJS)
 
-$(BUILD_DIR)/libmldsa.a: $(MLDSA44_OBJS) $(MLDSA65_OBJS) $(MLDSA87_OBJS)
+ifeq ($(SCU),1)
+# All parameter sets in a single compilation unit, exporting only the
+# public API. Unused internal functions are expected in this build.
+$(BUILD_DIR)/libmldsa.a: $(MLDSA44_DIR)/test/mldsa_native_all.c.o $(filter %.S.o,$(MLDSA44_OBJS))
+$(MLDSA44_DIR)/test/mldsa_native_all.c.o: CFLAGS += -Wno-unused-function
+else
+# All parameter sets, sharing the parameter-independent code
+$(BUILD_DIR)/libmldsa.a: $(MLDSA44_OBJS) \
+	$(call MAKE_OBJS,$(MLDSA65_DIR),$(filter-out $(SHARED_SOURCES),$(SOURCES))) \
+	$(call MAKE_OBJS,$(MLDSA87_DIR),$(filter-out $(SHARED_SOURCES),$(SOURCES)))
+endif
 
 $(MLDSA44_DIR)/bin/bench_mldsa44: CFLAGS += -Itest/hal
 $(MLDSA65_DIR)/bin/bench_mldsa65: CFLAGS += -Itest/hal
@@ -32,6 +57,9 @@ $(MLDSA87_DIR)/bin/bench_mldsa87: CFLAGS += -Itest/hal
 $(MLDSA44_DIR)/bin/bench_components_mldsa44: CFLAGS += -Itest/hal
 $(MLDSA65_DIR)/bin/bench_components_mldsa65: CFLAGS += -Itest/hal
 $(MLDSA87_DIR)/bin/bench_components_mldsa87: CFLAGS += -Itest/hal
+$(MLDSA44_DIR)/bin/bench_sweep_mldsa44: CFLAGS += -Itest/hal
+$(MLDSA65_DIR)/bin/bench_sweep_mldsa65: CFLAGS += -Itest/hal
+$(MLDSA87_DIR)/bin/bench_sweep_mldsa87: CFLAGS += -Itest/hal
 
 $(MLDSA44_DIR)/bin/bench_mldsa44: $(MLDSA44_DIR)/test/hal/hal.c.o
 $(MLDSA65_DIR)/bin/bench_mldsa65: $(MLDSA65_DIR)/test/hal/hal.c.o
@@ -39,6 +67,35 @@ $(MLDSA87_DIR)/bin/bench_mldsa87: $(MLDSA87_DIR)/test/hal/hal.c.o
 $(MLDSA44_DIR)/bin/bench_components_mldsa44: $(MLDSA44_DIR)/test/hal/hal.c.o
 $(MLDSA65_DIR)/bin/bench_components_mldsa65: $(MLDSA65_DIR)/test/hal/hal.c.o
 $(MLDSA87_DIR)/bin/bench_components_mldsa87: $(MLDSA87_DIR)/test/hal/hal.c.o
+$(MLDSA44_DIR)/bin/bench_sweep_mldsa44: $(MLDSA44_DIR)/test/hal/hal.c.o
+$(MLDSA65_DIR)/bin/bench_sweep_mldsa65: $(MLDSA65_DIR)/test/hal/hal.c.o
+$(MLDSA87_DIR)/bin/bench_sweep_mldsa87: $(MLDSA87_DIR)/test/hal/hal.c.o
+
+# All parameter sets, linked against libmldsa.a
+$(MLDSA44_DIR)/bin/bench_multilevel_mldsa: CFLAGS += -Itest/hal
+$(MLDSA44_DIR)/bin/bench_multilevel_mldsa: LDLIBS += -L$(BUILD_DIR) -lmldsa
+$(MLDSA44_DIR)/bin/bench_multilevel_mldsa: $(MLDSA44_DIR)/test/bench_multilevel_mldsa.c.o \
+	$(MLDSA44_DIR)/test/hal/hal.c.o $(BUILD_DIR)/libmldsa.a \
+	$(call MAKE_OBJS, $(MLDSA44_DIR), $(wildcard test/notrandombytes/*.c))
+
+$(MLDSA44_DIR)/bin/bench_load_mldsa44: LDLIBS += -pthread
+$(MLDSA65_DIR)/bin/bench_load_mldsa65: LDLIBS += -pthread
+$(MLDSA87_DIR)/bin/bench_load_mldsa87: LDLIBS += -pthread
+
+# The key pool refills itself from a background thread, and the
+# verification cache is protected by mutexes
+ifneq ($(findstring MLD_CONFIG_KEYPOOL,$(CFLAGS))$(findstring MLD_CONFIG_VERIFY_CACHE,$(CFLAGS)),)
+LDLIBS += -pthread
+endif
+
+# With MLD_CONFIG_CUSTOM_CAPABILITY_FUNC, the tests supply a capability
+# function reporting no optional extensions, so that the C fallbacks of
+# the capability-gated native backends are tested on any host
+ifneq ($(findstring MLD_CONFIG_CUSTOM_CAPABILITY_FUNC,$(CFLAGS)),)
+$(ALL_TESTS:%=$(MLDSA44_DIR)/bin/%44) $(MLDSA44_DIR)/bin/bench_multilevel_mldsa: $(call MAKE_OBJS, $(MLDSA44_DIR), test/nocaps/nocaps.c)
+$(ALL_TESTS:%=$(MLDSA65_DIR)/bin/%65): $(call MAKE_OBJS, $(MLDSA65_DIR), test/nocaps/nocaps.c)
+$(ALL_TESTS:%=$(MLDSA87_DIR)/bin/%87): $(call MAKE_OBJS, $(MLDSA87_DIR), test/nocaps/nocaps.c)
+endif
 
 $(MLDSA44_DIR)/bin/%: CFLAGS += -DMLDSA_MODE=2
 $(MLDSA65_DIR)/bin/%: CFLAGS += -DMLDSA_MODE=3
@@ -78,7 +78,8 @@ endif
 AUTO ?= 1
 CYCLES ?=
 OPT ?= 1
-RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO
+SCU ?= 0
+RETAINED_VARS := CROSS_PREFIX CYCLES OPT AUTO SCU
 
 ifeq ($(AUTO),1)
 include test/mk/auto.mk
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Single compilation unit containing all three parameter sets of
+ * mldsa-native, with only the public API exported.
+ *
+ * mldsa_native.c is included once per parameter set. The code shared
+ * between parameter sets is only included the first time, and the
+ * shared headers are only undefined after the last time. */
+
+#define MLD_CONFIG_INTERNAL_API_QUALIFIER static
+
+#define MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS
+#define MLDSA_MODE 2
+#include "../mldsa/mldsa_native.c"
+#undef MLDSA_MODE
+
+#define MLD_CONFIG_MULTILEVEL_NO_SHARED
+#define MLDSA_MODE 3
+#include "../mldsa/mldsa_native.c"
+#undef MLDSA_MODE
+
+#undef MLD_CONFIG_MONOBUILD_KEEP_SHARED_HEADERS
+#define MLDSA_MODE 5
+#include "../mldsa/mldsa_native.c"
+#undef MLDSA_MODE
+
+#undef MLD_CONFIG_MULTILEVEL_NO_SHARED
+#undef MLD_CONFIG_INTERNAL_API_QUALIFIER
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 The mldsa-native project authors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Capability function for test builds with
+ * MLD_CONFIG_CUSTOM_CAPABILITY_FUNC set; see test/mk/components.mk.
+ *
+ * It reports every optional instruction set extension as unavailable,
+ * so that the native backends gated on them always take the C fallback.
+ * Results must not change, so this runs the usual KAT and functional
+ * tests against the fallback paths even on hosts which have the
+ * extensions.
+ */
+
+#include "../../mldsa/common.h"
+
+int mld_sys_check_capability(mld_sys_cap cap)
+{
+  (void)cap;
+  return 0;
+}
@@ -20,6 +20,12 @@
 #include <valgrind/memcheck.h>
 #endif
 
+/* The key pool calls randombytes() from its refill thread */
+#if defined(MLD_CONFIG_KEYPOOL)
+#include <pthread.h>
+static pthread_mutex_t randombytes_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 static uint32_t seed[32] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3,
                             2, 3, 8, 4, 6, 2, 6, 4, 3, 3, 8, 3, 2, 7, 9, 5};
 static uint32_t in[12];
@@ -86,6 +92,9 @@ void randombytes(uint8_t *buf, size_t n)
   size_t n_orig = n;
 #endif
 
+#if defined(MLD_CONFIG_KEYPOOL)
+  pthread_mutex_lock(&randombytes_lock);
+#endif
   while (n > 0)
   {
     if (!outleft)
@@ -107,6 +116,9 @@ void randombytes(uint8_t *buf, size_t n)
     ++buf;
     --n;
   }
+#if defined(MLD_CONFIG_KEYPOOL)
+  pthread_mutex_unlock(&randombytes_lock);
+#endif
 
 #ifdef ENABLE_CT_TESTING
   /*
@@ -4,9 +4,14 @@
  */
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
-#include "../mldsa/api.h"
+#include "../mldsa/expanded.h"
+#include "../mldsa/keypool.h"
+#include "../mldsa/poly_kl.h"
+#include "../mldsa/sign.h"
+#include "../mldsa/verify_cache.h"
 #include "notrandombytes/notrandombytes.h"
 
 #define NTESTS 100
@@ -62,6 +67,54 @@ static int test_sign(void)
   return 0;
 }
 
+static int test_sign_inplace(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sm[MLEN + CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  const uint8_t *m2;
+  size_t smlen;
+  size_t mlen;
+  int rc;
+
+  crypto_sign_keypair(pk, sk);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  memcpy(sm + CRYPTO_BYTES, m, MLEN);
+  crypto_sign_inplace(sm, &smlen, MLEN, ctx, CTXLEN, sk);
+  rc = crypto_sign_open_inplace(&m2, &mlen, sm, smlen, ctx, CTXLEN, pk);
+
+  if (rc || m2 != sm + CRYPTO_BYTES || mlen != MLEN ||
+      smlen != MLEN + CRYPTO_BYTES || memcmp(m, m2, MLEN))
+  {
+    printf("ERROR: crypto_sign_open_inplace\n");
+    return 1;
+  }
+
+  /* crypto_sign_open must also accept m equal to sm */
+  rc = crypto_sign_open(sm, &mlen, sm, smlen, ctx, CTXLEN, pk);
+  if (rc || mlen != MLEN || memcmp(m, sm, MLEN))
+  {
+    printf("ERROR: crypto_sign_open - in place\n");
+    return 1;
+  }
+
+  memcpy(sm + CRYPTO_BYTES, m, MLEN);
+  crypto_sign_inplace(sm, &smlen, MLEN, ctx, CTXLEN, sk);
+  sm[CRYPTO_BYTES] ^= 1;
+  rc = crypto_sign_open_inplace(&m2, &mlen, sm, smlen, ctx, CTXLEN, pk);
+  if (!rc || m2 != NULL || mlen != 0)
+  {
+    printf("ERROR: crypto_sign_open_inplace - wrong message\n");
+    return 1;
+  }
+
+  return 0;
+}
+
 static int test_wrong_pk(void)
 {
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
@@ -198,6 +251,534 @@ static int test_wrong_ctx(void)
   return 0;
 }
 
+static int test_sign_seed(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t pk2[CRYPTO_PUBLICKEYBYTES];
+  uint8_t seed[MLDSA_SEEDBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t sig2[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  uint8_t pre[CTXLEN + 2];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  size_t siglen, siglen2;
+  int rc;
+
+  crypto_sign_keypair_seed(pk, seed);
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+
+  crypto_sign_pk_from_seed(pk2, seed);
+  if (memcmp(pk, pk2, CRYPTO_PUBLICKEYBYTES))
+  {
+    printf("ERROR: crypto_sign_pk_from_seed\n");
+    return 1;
+  }
+
+  crypto_sign_signature_seed(sig, &siglen, m, MLEN, ctx, CTXLEN, seed);
+  rc = crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk);
+  if (rc)
+  {
+    printf("ERROR: crypto_sign_signature_seed\n");
+    return 1;
+  }
+
+  if (siglen != CRYPTO_BYTES)
+  {
+    printf("ERROR: crypto_sign_signature_seed - wrong siglen\n");
+    return 1;
+  }
+
+  /* For the same seed and rnd, signing from the seed must give the same
+   * signature as signing with the expanded secret key */
+  crypto_sign_keypair_internal(pk2, sk, seed);
+  randombytes(rnd, MLDSA_RNDBYTES);
+  pre[0] = 0;
+  pre[1] = CTXLEN;
+  memcpy(pre + 2, ctx, CTXLEN);
+  crypto_sign_signature_seed_internal(sig, &siglen, m, MLEN, pre, sizeof(pre),
+                                      rnd, seed, 0);
+  crypto_sign_signature_internal(sig2, &siglen2, m, MLEN, pre, sizeof(pre), rnd,
+                                 sk, 0);
+  if (siglen != siglen2 || memcmp(sig, sig2, siglen))
+  {
+    printf("ERROR: crypto_sign_signature_seed_internal - signature mismatch\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+#define NBATCH 5
+
+/* Runs once, as it resets the PRNG: a batch of NBATCH key pairs
+ * (one group of four plus one remaining key pair) must consume the same
+ * randomness and produce the same key pairs as NBATCH calls of
+ * crypto_sign_keypair(). */
+static int test_keypair_batch(void)
+{
+  static uint8_t pk[NBATCH][CRYPTO_PUBLICKEYBYTES];
+  static uint8_t sk[NBATCH][CRYPTO_SECRETKEYBYTES];
+  static uint8_t pk2[NBATCH][CRYPTO_PUBLICKEYBYTES];
+  static uint8_t sk2[NBATCH][CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  size_t siglen;
+  unsigned i;
+
+  randombytes_reset();
+  crypto_sign_keypair_batch(pk[0], sk[0], NBATCH);
+
+  randombytes_reset();
+  for (i = 0; i < NBATCH; i++)
+  {
+    crypto_sign_keypair(pk2[i], sk2[i]);
+  }
+
+  if (memcmp(pk, pk2, sizeof(pk)) || memcmp(sk, sk2, sizeof(sk)))
+  {
+    printf("ERROR: crypto_sign_keypair_batch\n");
+    return 1;
+  }
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  for (i = 0; i < NBATCH; i++)
+  {
+    crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk[i]);
+    if (crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk[i]))
+    {
+      printf("ERROR: crypto_sign_keypair_batch - verification failed\n");
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+#define NSPARSE 20
+
+/* Draws a coefficient in [-bound_lo, bound_hi]: in round 0 all
+ * coefficients are bound_hi, in round 1 all are -bound_lo, in round 2
+ * each is one of the two limits, and after that uniformly random. */
+static int32_t sparse_mul_coeff(unsigned round, int32_t bound_lo,
+                                int32_t bound_hi)
+{
+  uint8_t b[4];
+  uint32_t u;
+
+  randombytes(b, sizeof(b));
+  u = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) |
+      ((uint32_t)b[3] << 24);
+  switch (round)
+  {
+    case 0:
+      return bound_hi;
+    case 1:
+      return -bound_lo;
+    case 2:
+      return (u & 1) ? bound_hi : -bound_lo;
+    default:
+      return (int32_t)(u % (uint32_t)(bound_lo + bound_hi + 1)) - bound_lo;
+  }
+}
+
+/* Computes c * a in Z_q[X]/(X^N + 1) via the NTT */
+static void sparse_mul_ref(poly *r, const poly *c, const poly *a)
+{
+  poly chat, ahat;
+
+  chat = *c;
+  ahat = *a;
+  poly_ntt(&chat);
+  poly_ntt(&ahat);
+  poly_pointwise_montgomery(r, &ahat, &chat);
+  poly_invntt_tomont(r);
+}
+
+static int sparse_mul_check(const char *name, const poly *r, const poly *c,
+                            const poly *a)
+{
+  poly ref;
+  unsigned i;
+
+  sparse_mul_ref(&ref, c, a);
+  for (i = 0; i < MLDSA_N; i++)
+  {
+    if ((r->coeffs[i] - ref.coeffs[i]) % MLDSA_Q != 0)
+    {
+      printf("ERROR: %s - mismatch at coefficient %u\n", name, i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* The exact sparse products used by compact-key signing must agree,
+ * modulo q, with the NTT-based product, for inputs at the limits of
+ * their ranges: s1/s2 in [-ETA, ETA] and t0 in
+ * (-2^{D-1}, 2^{D-1}]. */
+static int test_sparse_mul(void)
+{
+  uint8_t seed[MLDSA_CTILDEBYTES];
+  int8_t s[MLDSA_N];
+  int16_t t[MLDSA_N];
+  mld_sparse_challenge sc;
+  poly c, a, r;
+  unsigned i, round;
+
+  for (round = 0; round < NSPARSE; round++)
+  {
+    randombytes(seed, sizeof(seed));
+    poly_challenge(&c, seed);
+    poly_challenge_sparse(&sc, &c);
+
+    for (i = 0; i < MLDSA_N; i++)
+    {
+      s[i] = (int8_t)sparse_mul_coeff(round, MLDSA_ETA, MLDSA_ETA);
+      a.coeffs[i] = s[i];
+    }
+    poly_sparse_mul_s8(&r, &sc, s);
+    if (sparse_mul_check("poly_sparse_mul_s8", &r, &c, &a))
+    {
+      return 1;
+    }
+
+    for (i = 0; i < MLDSA_N; i++)
+    {
+      t[i] = (int16_t)sparse_mul_coeff(round, (1 << (MLDSA_D - 1)) - 1,
+                                       1 << (MLDSA_D - 1));
+      a.coeffs[i] = t[i];
+    }
+    poly_sparse_mul_s16(&r, &sc, t);
+    if (sparse_mul_check("poly_sparse_mul_s16", &r, &c, &a))
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+#define NPOLYVEC_NTT 20
+
+/* Fills n polynomials with uniform coefficients in (-MLDSA_Q, MLDSA_Q). */
+static void polyvec_ntt_random(poly *v, unsigned n)
+{
+  uint32_t buf[MLDSA_N];
+  unsigned i, j;
+
+  for (i = 0; i < n; i++)
+  {
+    randombytes((uint8_t *)buf, sizeof(buf));
+    for (j = 0; j < MLDSA_N; j++)
+    {
+      v[i].coeffs[j] =
+          (int32_t)(buf[j] % (2 * MLDSA_Q - 1)) - (MLDSA_Q - 1);
+    }
+  }
+}
+
+/* Checks that the polyvec (inverse) NTTs, which may transform the whole
+ * vector in one native call, agree with poly_ntt() and
+ * poly_invntt_tomont() applied to each polynomial in turn. */
+static int test_polyvec_ntt(void)
+{
+  polyvecl l, lref;
+  polyveck k, kref;
+  unsigned i, round;
+
+  for (round = 0; round < NPOLYVEC_NTT; round++)
+  {
+    polyvec_ntt_random(l.vec, MLDSA_L);
+    lref = l;
+    polyvecl_ntt(&l);
+    for (i = 0; i < MLDSA_L; i++)
+    {
+      poly_ntt(&lref.vec[i]);
+    }
+    if (memcmp(&l, &lref, sizeof(l)) != 0)
+    {
+      printf("ERROR: polyvecl_ntt\n");
+      return 1;
+    }
+
+    polyvec_ntt_random(l.vec, MLDSA_L);
+    lref = l;
+    polyvecl_invntt_tomont(&l);
+    for (i = 0; i < MLDSA_L; i++)
+    {
+      poly_invntt_tomont(&lref.vec[i]);
+    }
+    if (memcmp(&l, &lref, sizeof(l)) != 0)
+    {
+      printf("ERROR: polyvecl_invntt_tomont\n");
+      return 1;
+    }
+
+    polyvec_ntt_random(k.vec, MLDSA_K);
+    kref = k;
+    polyveck_ntt(&k);
+    for (i = 0; i < MLDSA_K; i++)
+    {
+      poly_ntt(&kref.vec[i]);
+    }
+    if (memcmp(&k, &kref, sizeof(k)) != 0)
+    {
+      printf("ERROR: polyveck_ntt\n");
+      return 1;
+    }
+
+    polyvec_ntt_random(k.vec, MLDSA_K);
+    kref = k;
+    polyveck_invntt_tomont(&k);
+    for (i = 0; i < MLDSA_K; i++)
+    {
+      poly_invntt_tomont(&kref.vec[i]);
+    }
+    if (memcmp(&k, &kref, sizeof(k)) != 0)
+    {
+      printf("ERROR: polyveck_invntt_tomont\n");
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/* Expanded keys are used in place and must be 4-byte aligned */
+static uint32_t
+    epk_buf[(CRYPTO_EXPANDED_PUBLICKEYBYTES + 3) / sizeof(uint32_t)];
+static uint32_t
+    esk_buf[(CRYPTO_EXPANDED_SECRETKEYBYTES + 3) / sizeof(uint32_t)];
+static uint32_t
+    csk_buf[(CRYPTO_COMPACT_SECRETKEYBYTES + 3) / sizeof(uint32_t)];
+
+static int test_expanded(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  uint8_t *epk = (uint8_t *)epk_buf;
+  uint8_t *esk = (uint8_t *)esk_buf;
+  uint8_t *csk = (uint8_t *)csk_buf;
+  uint8_t sig2[CRYPTO_BYTES];
+  uint8_t rnd[MLDSA_RNDBYTES];
+  uint8_t pre[CTXLEN + 2];
+  size_t siglen, siglen2;
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  crypto_sign_keypair(pk, sk);
+
+  if (crypto_sign_expand_pk(epk, pk) || crypto_sign_expand_sk(esk, sk) ||
+      crypto_sign_expanded_pk_check(epk, CRYPTO_EXPANDED_PUBLICKEYBYTES) ||
+      crypto_sign_expanded_sk_check(esk, CRYPTO_EXPANDED_SECRETKEYBYTES))
+  {
+    printf("ERROR: crypto_sign_expand\n");
+    return 1;
+  }
+
+  if (crypto_sign_compact_sk(csk, sk) ||
+      crypto_sign_compact_sk_check(csk, CRYPTO_COMPACT_SECRETKEYBYTES))
+  {
+    printf("ERROR: crypto_sign_compact_sk\n");
+    return 1;
+  }
+
+  crypto_sign_signature_compact(sig, &siglen, m, MLEN, ctx, CTXLEN, csk);
+  if (siglen != CRYPTO_BYTES ||
+      crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk))
+  {
+    printf("ERROR: crypto_sign_signature_compact\n");
+    return 1;
+  }
+
+  /* For the same rnd, signing with the compact key must give the same
+   * signature as signing with the bit-packed key */
+  randombytes(rnd, MLDSA_RNDBYTES);
+  pre[0] = 0;
+  pre[1] = CTXLEN;
+  memcpy(pre + 2, ctx, CTXLEN);
+  crypto_sign_signature_compact_internal(sig, &siglen, m, MLEN, pre,
+                                         sizeof(pre), rnd, csk, 0);
+  crypto_sign_signature_internal(sig2, &siglen2, m, MLEN, pre, sizeof(pre), rnd,
+                                 sk, 0);
+  if (siglen != siglen2 || memcmp(sig, sig2, siglen))
+  {
+    printf(
+        "ERROR: crypto_sign_signature_compact_internal - signature mismatch\n");
+    return 1;
+  }
+
+  /* Expanded and bit-packed keys must be interchangeable */
+  crypto_sign_signature_expanded(sig, &siglen, m, MLEN, ctx, CTXLEN, esk);
+  if (siglen != CRYPTO_BYTES ||
+      crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk) ||
+      crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk))
+  {
+    printf("ERROR: crypto_sign_signature_expanded\n");
+    return 1;
+  }
+
+  crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+  if (crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk))
+  {
+    printf("ERROR: crypto_sign_verify_expanded\n");
+    return 1;
+  }
+
+  m[0] ^= 1;
+  if (!crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk))
+  {
+    printf("ERROR: crypto_sign_verify_expanded - wrong message\n");
+    return 1;
+  }
+  m[0] ^= 1;
+
+  /* Truncation, corruption and misalignment must be detected */
+  epk[CRYPTO_EXPANDED_PUBLICKEYBYTES - 1] ^= 1;
+  esk[CRYPTO_EXPANDED_SECRETKEYBYTES / 2] ^= 1;
+  csk[CRYPTO_COMPACT_SECRETKEYBYTES - 1] ^= 1;
+  if (!crypto_sign_expanded_pk_check(epk, CRYPTO_EXPANDED_PUBLICKEYBYTES) ||
+      !crypto_sign_expanded_sk_check(esk, CRYPTO_EXPANDED_SECRETKEYBYTES) ||
+      !crypto_sign_compact_sk_check(csk, CRYPTO_COMPACT_SECRETKEYBYTES) ||
+      !crypto_sign_expanded_pk_check(epk, CRYPTO_EXPANDED_PUBLICKEYBYTES - 1) ||
+      !crypto_sign_expand_pk(epk + 1, pk))
+  {
+    printf("ERROR: crypto_sign_expanded_check\n");
+    return 1;
+  }
+
+  /* A header for a different format must be rejected */
+  epk[0] ^= 1;
+  if (!crypto_sign_verify_expanded(sig, siglen, m, MLEN, ctx, CTXLEN, epk))
+  {
+    printf("ERROR: crypto_sign_verify_expanded - invalid header\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+#if defined(MLD_CONFIG_KEYPOOL)
+#define NPOOL 4
+#define NPOP 10
+
+/* Takes more key pairs than the pool holds, so that both pooled key
+ * pairs and key pairs generated on demand are handed out. */
+static int test_keypool(void)
+{
+  uint8_t pk[CRYPTO_PUBLICKEYBYTES];
+  uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  uint8_t sig[CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  size_t siglen;
+  unsigned i;
+
+  if (crypto_sign_keypool_init(NPOOL) || !crypto_sign_keypool_init(NPOOL))
+  {
+    printf("ERROR: crypto_sign_keypool_init\n");
+    return 1;
+  }
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  for (i = 0; i < NPOP; i++)
+  {
+    crypto_sign_keypool_pop(pk, sk);
+    crypto_sign_signature(sig, &siglen, m, MLEN, ctx, CTXLEN, sk);
+    if (crypto_sign_verify(sig, siglen, m, MLEN, ctx, CTXLEN, pk))
+    {
+      printf("ERROR: crypto_sign_keypool_pop\n");
+      crypto_sign_keypool_free();
+      return 1;
+    }
+  }
+
+  crypto_sign_keypool_free();
+  return 0;
+}
+#endif /* MLD_CONFIG_KEYPOOL */
+
+#if defined(MLD_CONFIG_VERIFY_CACHE)
+#define NCACHEKEYS 40
+
+/* Runs once, as it checks the cache counters: repeated verifications
+ * under the same public key must hit the cache, and verifications must
+ * be correct whether or not the public key is cached or was evicted. */
+static int test_verify_cache(void)
+{
+  static uint8_t pk[NCACHEKEYS][CRYPTO_PUBLICKEYBYTES];
+  static uint8_t sk[NCACHEKEYS][CRYPTO_SECRETKEYBYTES];
+  static uint8_t sig[NCACHEKEYS][CRYPTO_BYTES];
+  uint8_t m[MLEN];
+  uint8_t ctx[CTXLEN];
+  size_t siglen;
+  uint64_t hits, misses;
+  unsigned i, j;
+
+  randombytes(ctx, CTXLEN);
+  randombytes(m, MLEN);
+  crypto_sign_verify_cache_clear();
+
+  crypto_sign_keypair(pk[0], sk[0]);
+  crypto_sign_signature(sig[0], &siglen, m, MLEN, ctx, CTXLEN, sk[0]);
+  for (j = 0; j < 3; j++)
+  {
+    if (crypto_sign_verify(sig[0], siglen, m, MLEN, ctx, CTXLEN, pk[0]))
+    {
+      printf("ERROR: crypto_sign_verify with verify cache\n");
+      return 1;
+    }
+  }
+
+  crypto_sign_verify_cache_stats(&hits, &misses);
+  if (hits != 2 || misses != 1)
+  {
+    printf("ERROR: crypto_sign_verify_cache_stats\n");
+    return 1;
+  }
+
+  /* A cache hit must not make a wrong message verify */
+  m[0] ^= 1;
+  if (!crypto_sign_verify(sig[0], siglen, m, MLEN, ctx, CTXLEN, pk[0]))
+  {
+    printf("ERROR: crypto_sign_verify with verify cache - wrong message\n");
+    return 1;
+  }
+  m[0] ^= 1;
+
+  /* More public keys than the cache holds, verified twice each */
+  for (i = 1; i < NCACHEKEYS; i++)
+  {
+    crypto_sign_keypair(pk[i], sk[i]);
+    crypto_sign_signature(sig[i], &siglen, m, MLEN, ctx, CTXLEN, sk[i]);
+  }
+  for (j = 0; j < 2; j++)
+  {
+    for (i = 0; i < NCACHEKEYS; i++)
+    {
+      if (crypto_sign_verify(sig[i], siglen, m, MLEN, ctx, CTXLEN, pk[i]) ||
+          (i > 0 &&
+           !crypto_sign_verify(sig[i], siglen, m, MLEN, ctx, CTXLEN, pk[0])))
+      {
+        printf("ERROR: crypto_sign_verify with verify cache - eviction\n");
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+#endif /* MLD_CONFIG_VERIFY_CACHE */
+
 int main(void)
 {
   unsigned i;
@@ -207,12 +788,48 @@ int main(void)
    * Normally, you would want to seed a PRNG with trustworthy entropy here. */
   randombytes_reset();
 
+  if (test_keypair_batch())
+  {
+    return 1;
+  }
+
+  if (test_sparse_mul())
+  {
+    return 1;
+  }
+
+  if (test_polyvec_ntt())
+  {
+    return 1;
+  }
+
+  if (test_expanded())
+  {
+    return 1;
+  }
+
+#if defined(MLD_CONFIG_KEYPOOL)
+  if (test_keypool())
+  {
+    return 1;
+  }
+#endif
+
+#if defined(MLD_CONFIG_VERIFY_CACHE)
+  if (test_verify_cache())
+  {
+    return 1;
+  }
+#endif
+
   for (i = 0; i < NTESTS; i++)
   {
     r = test_sign();
+    r |= test_sign_inplace();
     r |= test_wrong_pk();
     r |= test_wrong_sig();
     r |= test_wrong_ctx();
+    r |= test_sign_seed();
     if (r)
     {
       return 1;